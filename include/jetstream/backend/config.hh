@@ -1,6 +1,8 @@
 #ifndef JETSTREAM_BACKEND_CONFIG_HH
 #define JETSTREAM_BACKEND_CONFIG_HH
 
+#include <vector>
+
 #include "jetstream/logger.hh"
 #include "jetstream/types.hh"
 
@@ -34,6 +36,38 @@ inline std::ostream& operator<<(std::ostream& os, const PhysicalDeviceType& type
     return os;
 }
 
+enum class ThreadPolicy : uint8_t {
+    DEFAULT     = 0,
+    FIFO        = 1,
+    ROUND_ROBIN = 2,
+};
+
+inline ThreadPolicy StringToThreadPolicy(const std::string& policy) {
+    if (policy == "fifo") {
+        return ThreadPolicy::FIFO;
+    }
+    if (policy == "rr") {
+        return ThreadPolicy::ROUND_ROBIN;
+    }
+    return ThreadPolicy::DEFAULT;
+}
+
+enum class HugePages : uint8_t {
+    NONE        = 0,
+    TRANSPARENT = 1,
+    EXPLICIT    = 2,
+};
+
+inline HugePages StringToHugePages(const std::string& mode) {
+    if (mode == "transparent") {
+        return HugePages::TRANSPARENT;
+    }
+    if (mode == "explicit") {
+        return HugePages::EXPLICIT;
+    }
+    return HugePages::NONE;
+}
+
 struct Config {
     U64 deviceId = 0;
 #ifdef JST_DEBUG_MODE
@@ -44,6 +78,21 @@ struct Config {
     U64 stagingBufferSize = 64*1024*1024;
     U64 multisampling = 4;
     bool headless = false;
+    U64 computeThreads = 0;
+    // Cores of the compute threads. Thread N is pinned to the Nth core.
+    std::vector<U64> computeCores = {};
+    // Cores shared by the threads feeding or draining devices.
+    std::vector<U64> ioCores = {};
+    // Real-time scheduling. Device threads run one priority level above.
+    ThreadPolicy threadPolicy = ThreadPolicy::DEFAULT;
+    U64 threadPriority = 1;
+    bool lockMemory = false;
+    // Places CPU tensors on the NUMA nodes of the compute cores.
+    bool numaLocalMemory = false;
+    // Freed CPU tensors are kept for reuse up to this many bytes.
+    U64 memoryPoolSize = 512*1024*1024;
+    // Backing of CPU tensors larger than a huge page.
+    HugePages hugePages = HugePages::NONE;
 };
 
 }  // namespace Jetstream::Backend
@@ -1,13 +1,45 @@
 #ifndef JETSTREAM_BACKEND_DEVICE_CPU_HH
 #define JETSTREAM_BACKEND_DEVICE_CPU_HH
 
+#include <memory>
+
 #include "jetstream/backend/config.hh"
+#include "jetstream/compute/executor.hh"
 
 namespace Jetstream::Backend {
 
 class CPU {
  public:
     explicit CPU(const Config& config);
+
+    // Pins the calling thread to its compute core and applies the
+    // real-time policy. The index follows the numbering of the executor.
+    Result placeComputeThread(const U64& index = 0) const;
+
+    // Same for threads moving samples from or to a device.
+    Result placeIoThread() const;
+
+    // Thread pool shared by every CPU graph and kernel.
+    const std::shared_ptr<Executor>& getExecutor() const {
+        return executor;
+    }
+
+    Result parallelFor(const U64& size, const Executor::RangeTask& task, const U64& grain = 1) const {
+        return executor->parallelFor(size, task, grain);
+    }
+
+    template<typename T, class Map, class Combine>
+    Result parallelReduce(const U64& size,
+                          T& result,
+                          const Map& map,
+                          const Combine& combine,
+                          const U64& grain = 1) const {
+        return executor->parallelReduce(size, result, map, combine, grain);
+    }
+
+ private:
+    Config config;
+    std::shared_ptr<Executor> executor;
 };
 
 }  // namespace Jetstream::Backend
@@ -1,11 +1,14 @@
 #ifndef JETSTREAM_BACKEND_DEVICE_CPU_HELPERS_HH
 #define JETSTREAM_BACKEND_DEVICE_CPU_HELPERS_HH
 
+#include <bit>
+#include <algorithm>
 #include <math.h>
 
 #include "jetstream/types.hh"
 #include "jetstream/macros.hh"
 #include "jetstream/memory/base.hh"
+#include "jetstream/memory/utils/display_storage.hh"
 
 namespace Jetstream::Backend {
 
@@ -71,6 +74,71 @@ inline F32 ApproxLog10(const F32& X) {
     return Y * 0.3010299956639812f;
 }
 
+// Clamps to [0, max] and sends NaN to zero. The quantizers clamp right before
+// leaving floating point, as further float math on the result keeps the
+// compiler from vectorizing the loop.
+inline F32 ClampRange(const F32& X, const F32& max) {
+    const F32 Y = (X > 0.0f) ? X : 0.0f;
+    return (Y < max) ? Y : max;
+}
+
+// Rounds a [0, 1] value to the nearest half float. Values under the smallest
+// normal half flush to zero, which is invisible on a display.
+inline U16 FloatToHalf(const F32& X) {
+    const U32 bits = std::bit_cast<U32>(ClampRange(X, 1.0f));
+    const U32 half = ((bits + 0xFFF + ((bits >> 13) & 1)) >> 13) - (112 << 10);
+    return static_cast<U16>((bits < 0x38800000) ? 0 : half);
+}
+
+// Inverse of FloatToHalf. Only zero and normal halves are expected.
+inline F32 HalfToFloat(const U16& X) {
+    const U32 bits = (static_cast<U32>(X) << 13) + (112 << 23);
+    return std::bit_cast<F32>(bits & (0U - static_cast<U32>(X != 0)));
+}
+
+inline U8 FloatToUnorm8(const F32& X) {
+    return static_cast<U8>(static_cast<I32>(ClampRange(X * 255.0f + 0.5f, 255.0f)));
+}
+
+inline void QuantizeToF16(const F32* input, U16* output, const U64& size) {
+    for (U64 i = 0; i < size; i++) {
+        output[i] = FloatToHalf(input[i]);
+    }
+}
+
+inline void QuantizeToU8(const F32* input, U8* output, const U64& size) {
+    // Byte stores may alias the size.
+    const U64 length = size;
+
+    for (U64 i = 0; i < length; i++) {
+        output[i] = FloatToUnorm8(input[i]);
+    }
+}
+
+inline void QuantizeHalfToU8(const U16* input, U8* output, const U64& size) {
+    const U64 length = size;
+
+    for (U64 i = 0; i < length; i++) {
+        output[i] = FloatToUnorm8(HalfToFloat(input[i]));
+    }
+}
+
+// Writes `size` values starting at element `offset` of a display buffer.
+inline void StoreDisplayValues(const Memory::DisplayStorage& storage, const F32* input,
+                               void* output, const U64& offset, const U64& size) {
+    switch (storage) {
+        case Memory::DisplayStorage::F16:
+            QuantizeToF16(input, static_cast<U16*>(output) + offset, size);
+            break;
+        case Memory::DisplayStorage::U8:
+            QuantizeToU8(input, static_cast<U8*>(output) + offset, size);
+            break;
+        case Memory::DisplayStorage::F32:
+            std::copy(input, input + size, static_cast<F32*>(output) + offset);
+            break;
+    }
+}
+
 inline I32 GetSocketBufferSize() {
     I32 bufferSize = 0;
     I32 recommendedBufferSize = 32*1024*1024;  // 32 MB
@@ -18,8 +18,9 @@ class Audio : public Block {
         std::string deviceName = "Default";
         F32 inSampleRate = 48e3;
         F32 outSampleRate = 48e3;
+        std::string overflowPolicy = "drop-oldest";
 
-        JST_SERDES(deviceName, inSampleRate, outSampleRate);
+        JST_SERDES(deviceName, inSampleRate, outSampleRate, overflowPolicy);
     };
 
     constexpr const Config& getConfig() const {
@@ -91,6 +92,7 @@ class Audio : public Block {
                 .deviceName = config.deviceName,
                 .inSampleRate = config.inSampleRate,
                 .outSampleRate = config.outSampleRate,
+                .overflowPolicy = config.overflowPolicy,
             }, {
                 .buffer = input.buffer,
             },
@@ -25,7 +25,11 @@ namespace Jetstream::Blocks {
     JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CF32, F32) \
     JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, F32, CF32) \
     JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, F32, F32) \
-    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, F32, I16)
+    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, F32, I16) \
+    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CI8, void) \
+    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CI16, void) \
+    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CI8, CF32) \
+    JST_BLOCKS_MANIFEST_ADD(BLOCK, DEVICE, CI16, CF32)
     
 #define JST_BLOCKS_MANIFEST_DEVICE(BLOCK) \
     JST_BLOCKS_MANIFEST_TYPE(BLOCK, Device::CPU) \
@@ -24,11 +24,13 @@ class Soapy : public Block {
         U64 numberOfBatches = 8;
         U64 numberOfTimeSamples = 8192;
         U64 bufferMultiplier = 4;
+        std::string overflowPolicy = "drop-oldest";
+        F32 bufferWatermark = 0.75;
 
         JST_SERDES(hintString, deviceString, streamString,
                    frequency, sampleRate, automaticGain, 
                    numberOfBatches, numberOfTimeSamples, 
-                   bufferMultiplier);
+                   bufferMultiplier, overflowPolicy, bufferWatermark);
     };
 
     constexpr const Config& getConfig() const {
@@ -111,6 +113,8 @@ class Soapy : public Block {
                 .numberOfBatches = config.numberOfBatches,
                 .numberOfTimeSamples = config.numberOfTimeSamples,
                 .bufferMultiplier = config.bufferMultiplier,
+                .overflowPolicy = config.overflowPolicy,
+                .bufferWatermark = config.bufferWatermark,
             }, {},
             locale()
         ));
@@ -144,20 +148,23 @@ class Soapy : public Block {
         ImGui::TextFormatted("{} ({})", soapy->getDeviceName(), soapy->getDeviceHardwareKey());
 
         const F32& bufferOccupancy = buffer.getOccupancy();
-        const F32 bufferOccupancyMB = (bufferOccupancy * sizeof(CF32) / JST_MB);
+        const F32 bufferOccupancyMB = (bufferOccupancy * sizeof(IT) / JST_MB);
 
         const F32& bufferCapacity = buffer.getCapacity();
-        const F32 bufferCapacityMB = (bufferCapacity * sizeof(CF32) / JST_MB);
+        const F32 bufferCapacityMB = (bufferCapacity * sizeof(IT) / JST_MB);
 
         const F32& bufferThroughput = buffer.getThroughput();
-        const F32 bufferThroughputMB = (bufferThroughput * sizeof(CF32) / JST_MB);
+        const F32 bufferThroughputMB = (bufferThroughput * sizeof(IT) / JST_MB);
 
         ImGui::TableNextRow();
         ImGui::TableSetColumnIndex(0);
         ImGui::TextUnformatted("Buffer Health");
         ImGui::TableSetColumnIndex(1);
         const F32 bufferUsageRatio = bufferOccupancy / bufferCapacity;
-        const auto bufferOverlay = jst::fmt::format("{:.0f}/{:.0f} MB ({})", bufferOccupancyMB, bufferCapacityMB, buffer.getOverflows());
+        const auto bufferOverlay = jst::fmt::format("{:.0f}/{:.0f} MB ({} / {:.1f} MS dropped)", bufferOccupancyMB,
+                                                                                                bufferCapacityMB,
+                                                                                                buffer.getOverflows(),
+                                                                                                buffer.getDroppedElements() / 1e6);
         ImGui::SetNextItemWidth(-1);
         ImGui::ProgressBar(bufferUsageRatio, ImVec2(0.0f, 0.0f), bufferOverlay.c_str());
 
@@ -165,7 +172,7 @@ class Soapy : public Block {
         ImGui::TableSetColumnIndex(0);
         ImGui::TextUnformatted("Throughput");
         ImGui::TableSetColumnIndex(1);
-        const F32 sdrThroughputMB = ((soapy->getConfig().sampleRate * sizeof(CF32)) / JST_MB);
+        const F32 sdrThroughputMB = ((soapy->getConfig().sampleRate * sizeof(IT)) / JST_MB);
         const F32 throughputRatio = (bufferThroughputMB / sdrThroughputMB) * 0.5f;
         const auto throughputOverlay = jst::fmt::format("{:.0f}/{:.0f} MB/s", bufferThroughputMB, sdrThroughputMB);
         ImGui::SetNextItemWidth(-1);
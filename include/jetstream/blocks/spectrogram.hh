@@ -15,8 +15,9 @@ class Spectrogram : public Block {
     struct Config {
         U64 height = 256;
         Size2D<U64> viewSize = {512, 384};
+        std::string storage = "F32";
 
-        JST_SERDES(height, viewSize);
+        JST_SERDES(height, viewSize, storage);
     };
 
     constexpr const Config& getConfig() const {
@@ -75,6 +76,7 @@ class Spectrogram : public Block {
             spectrogram, "spectrogram", {
                 .height = config.height,
                 .viewSize = config.viewSize,
+                .storage = config.storage,
             }, {
                 .buffer = input.buffer,
             },
@@ -18,8 +18,9 @@ class Waterfall : public Block {
         U64 height = 512;
         bool interpolate = true;
         Size2D<U64> viewSize = {512, 384};
+        std::string storage = "F32";
 
-        JST_SERDES(zoom, offset, height, interpolate, viewSize);
+        JST_SERDES(zoom, offset, height, interpolate, viewSize, storage);
     };
 
     constexpr const Config& getConfig() const {
@@ -81,6 +82,7 @@ class Waterfall : public Block {
                 .height = config.height,
                 .interpolate = config.interpolate,
                 .viewSize = config.viewSize,
+                .storage = config.storage,
             }, {
                 .buffer = input.buffer,
             },
@@ -0,0 +1,34 @@
+#ifndef JETSTREAM_COMPUTE_CONTIGUOUS_HH
+#define JETSTREAM_COMPUTE_CONTIGUOUS_HH
+
+#include <vector>
+#include <functional>
+
+#include "jetstream/types.hh"
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+
+namespace Jetstream {
+
+// Fills the contiguous copies a module reads in place of discontiguous
+// views or of inputs it overwrites. The scheduler adds it right before that
+// module, so views only cost a copy when a reader actually needs contiguous
+// data, and in-place modules never clobber a Vector other modules read.
+
+class JETSTREAM_API Contiguous : public Compute {
+ public:
+    explicit Contiguous(const std::vector<std::function<Result()>>& copies);
+
+    Result compute(const Context& ctx) final;
+
+    constexpr bool transientOutputs() const final {
+        return true;
+    }
+
+ private:
+    std::vector<std::function<Result()>> copies;
+};
+
+}  // namespace Jetstream
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef JETSTREAM_COMPUTE_EXECUTOR_HH
+#define JETSTREAM_COMPUTE_EXECUTOR_HH
+
+#include <mutex>
+#include <deque>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <functional>
+#include <condition_variable>
+
+#include "jetstream/types.hh"
+#include "jetstream/logger.hh"
+
+namespace Jetstream {
+
+// Work-stealing worker pool. A call to `run` hands a batch of tasks to the
+// pool and returns only after all of them finished. The calling thread keeps
+// executing tasks while it waits, so a pool with N workers runs up to N + 1
+// tasks at the same time and tasks can safely call `run` themselves.
+// Each worker owns a queue and steals from the others once it runs dry.
+// Workers are spawned lazily and are kept alive until the executor is destroyed.
+// The range helpers split `[0, size)` into at most one chunk per thread. The
+// split only depends on the size and on the pool capacity, so reductions are
+// combined in the same order every time.
+
+class JETSTREAM_API Executor {
+ public:
+    typedef std::function<Result()> Task;
+    typedef std::vector<std::vector<U64>> Dependents;
+    typedef std::function<Result(const U64& begin, const U64& end)> RangeTask;
+    // Called by every worker before it takes any task. Workers are numbered
+    // from one. Zero is the thread calling `run`.
+    typedef std::function<void(const U64& worker)> WorkerInit;
+
+    explicit Executor(const U64& maxWorkers = DefaultNumberOfWorkers(), const WorkerInit& workerInit = {});
+    ~Executor();
+
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    // Runs independent tasks.
+    Result run(const std::vector<Task>& tasks);
+
+    // Runs a task graph. The list `dependents[i]` holds the tasks that can
+    // only start after task `i` finished. Tasks have to be listed in an
+    // order that is also valid for sequential execution.
+    Result run(const std::vector<Task>& tasks, const Dependents& dependents);
+
+    // Runs `task` over consecutive chunks of at least `grain` indices.
+    Result parallelFor(const U64& size, const RangeTask& task, const U64& grain = 1);
+
+    // Maps every chunk to a partial value and folds them into `result`.
+    template<typename T, class Map, class Combine>
+    Result parallelReduce(const U64& size,
+                          T& result,
+                          const Map& map,
+                          const Combine& combine,
+                          const U64& grain = 1) {
+        std::vector<T> partials(numberOfChunks(size, grain), result);
+        JST_CHECK(runChunks(size, grain, [&](const U64& chunk, const U64& begin, const U64& end) {
+            partials[chunk] = map(begin, end);
+            return Result::SUCCESS;
+        }));
+        for (const auto& partial : partials) {
+            result = combine(result, partial);
+        }
+        return Result::SUCCESS;
+    }
+
+    U64 numberOfWorkers() const {
+        return spawnedWorkers;
+    }
+
+    U64 concurrency() const {
+        return maxWorkers + 1;
+    }
+
+    U64 numberOfChunks(const U64& size, const U64& grain = 1) const;
+
+    static U64 DefaultNumberOfWorkers();
+
+ private:
+    struct Batch;
+
+    struct Item {
+        Batch* batch;
+        U64 index;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Item> items;
+    };
+
+    std::mutex mutex;
+    std::condition_variable cond;
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::atomic<U64> spawnedWorkers{0};
+    std::atomic<U64> queuedItems{0};
+    U64 maxWorkers;
+    WorkerInit workerInit;
+    bool running = true;
+
+    Result runBatch(Batch& batch);
+    void spawnWorkers(const U64& count);
+    void workerLoop(const U64& queueId);
+    void push(const Item& item);
+    bool pop(Item& item);
+    void execute(const Item& item);
+
+    typedef std::function<Result(const U64& chunk, const U64& begin, const U64& end)> ChunkTask;
+    Result runChunks(const U64& size, const U64& grain, const ChunkTask& task);
+};
+
+}  // namespace Jetstream
+
+#endif
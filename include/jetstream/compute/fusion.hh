@@ -0,0 +1,52 @@
+#ifndef JETSTREAM_COMPUTE_FUSION_HH
+#define JETSTREAM_COMPUTE_FUSION_HH
+
+#include <memory>
+#include <vector>
+
+#include "jetstream/types.hh"
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+
+namespace Jetstream {
+
+// Runs a chain of elementwise modules as a single pass. The flattened
+// output is split into tiles and every module processes a tile before the
+// next one starts, so intermediate Vectors are read back while still in cache.
+// Lane `l` computes the tiles `l`, `l + lanes`, and so on. Lanes running at the
+// same time never touch the same tile modulo `lanes`, so the scheduler can back
+// intermediates nothing else reads with a ring of `lanes` tiles.
+
+class JETSTREAM_API Fusion : public Compute {
+ public:
+    Fusion(const std::vector<std::shared_ptr<Compute>>& blocks, const U64& numberOfElements, const U64& lanes);
+
+    constexpr const std::vector<std::shared_ptr<Compute>>& getBlocks() const {
+        return blocks;
+    }
+
+    constexpr const U64& getNumberOfElements() const {
+        return numberOfElements;
+    }
+
+    constexpr const U64& getLanes() const {
+        return lanes;
+    }
+
+    Result createCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+    Result computeReady() final;
+    Result destroyCompute(const Context& ctx) final;
+
+    // Elements per tile. Even so that paired kernels are never split.
+    static constexpr U64 TileSize = 4096;
+
+ private:
+    std::vector<std::shared_ptr<Compute>> blocks;
+    U64 numberOfElements;
+    U64 lanes;
+};
+
+}  // namespace Jetstream
+
+#endif
@@ -18,6 +18,36 @@ class CPU : public Graph {
     Result compute();
     Result computeReady();
     Result destroy();
+
+    // Data-parallel helpers for kernels. They run inline without an executor.
+
+    U64 concurrency() const {
+        return (executor) ? executor->concurrency() : 1;
+    }
+
+    Result parallelFor(const U64& size, const Executor::RangeTask& task, const U64& grain = 1) const {
+        if (!executor) {
+            return (size > 0) ? task(0, size) : Result::SUCCESS;
+        }
+        return executor->parallelFor(size, task, grain);
+    }
+
+    template<typename T, class Map, class Combine>
+    Result parallelReduce(const U64& size,
+                          T& result,
+                          const Map& map,
+                          const Combine& combine,
+                          const U64& grain = 1) const {
+        if (!executor) {
+            result = (size > 0) ? combine(result, map(0, size)) : result;
+            return Result::SUCCESS;
+        }
+        return executor->parallelReduce(size, result, map, combine, grain);
+    }
+
+ private:
+    std::vector<Executor::Task> blockTasks;
+    Executor::Dependents blockDependents;
 };
 
 }  // namespace Jetstream
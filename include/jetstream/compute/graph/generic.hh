@@ -7,6 +7,7 @@
 #include "jetstream/memory/types.hh"
 #include "jetstream/logger.hh"
 #include "jetstream/module.hh"
+#include "jetstream/compute/executor.hh"
 
 namespace Jetstream { 
 
@@ -14,7 +15,10 @@ class Graph {
  public:
     virtual ~Graph() = default;
 
-    Result setModule(const std::shared_ptr<Compute>& block);
+    Result setModule(const std::shared_ptr<Compute>& block,
+                     const std::set<U64>& inputs = {},
+                     const std::set<U64>& outputs = {});
+    Result setExecutor(const std::shared_ptr<Executor>& executor);
 
     Result setWiredInput(const U64& input);
     Result setWiredOutput(const U64& output);
@@ -37,6 +41,9 @@ class Graph {
         return externallyWiredOutputSet;
     }
 
+    // True if both graphs hold the same modules wired the same way.
+    bool isEquivalent(const Graph& other) const;
+
     virtual constexpr Device device() const = 0;
     virtual Result create() = 0;
     virtual Result compute() = 0;
@@ -45,7 +52,10 @@ class Graph {
 
  protected:
     std::shared_ptr<Compute::Context> context;
+    std::shared_ptr<Executor> executor;
     std::vector<std::shared_ptr<Compute>> blocks;
+    std::vector<std::set<U64>> blockInputs;
+    std::vector<std::set<U64>> blockOutputs;
     std::set<U64> wiredInputSet;
     std::set<U64> wiredOutputSet;
     std::set<U64> externallyWiredInputSet;
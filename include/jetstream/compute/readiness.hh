@@ -0,0 +1,39 @@
+#ifndef JETSTREAM_COMPUTE_READINESS_HH
+#define JETSTREAM_COMPUTE_READINESS_HH
+
+#include <mutex>
+#include <condition_variable>
+
+#include "jetstream/types.hh"
+#include "jetstream/logger.hh"
+
+namespace Jetstream {
+
+// Wakes the compute thread. Sources notify it when new data arrives and the
+// scheduler sleeps on it until then. Cancelling releases the current and any
+// future wait until resumed, so state changes don't wait for the sources.
+
+class JETSTREAM_API Readiness {
+ public:
+    // Read before checking the sources. Notifications after this point
+    // make `wait` return right away.
+    U64 getEpoch() const;
+
+    void notify();
+
+    // Returns Result::SKIP if the wait was cancelled.
+    Result wait(const U64& epoch);
+
+    void cancel();
+    void resume();
+
+ private:
+    mutable std::mutex mutex;
+    std::condition_variable cond;
+    U64 epoch = 0;
+    bool cancelled = false;
+};
+
+}  // namespace Jetstream
+
+#endif
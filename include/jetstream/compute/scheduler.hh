@@ -1,6 +1,7 @@
 #ifndef JETSTREAM_COMPUTE_SCHEDULER_HH
 #define JETSTREAM_COMPUTE_SCHEDULER_HH
 
+#include <any>
 #include <memory>
 #include <stack>
 #include <vector>
@@ -11,11 +12,28 @@
 #include <unordered_set>
 
 #include "jetstream/compute/graph/base.hh"
+#include "jetstream/compute/executor.hh"
+#include "jetstream/compute/contiguous.hh"
+#include "jetstream/compute/fusion.hh"
+#include "jetstream/compute/readiness.hh"
+#include "jetstream/compute/throttle.hh"
+#include "jetstream/memory/utils/mirrored_memory.hh"
 
 namespace Jetstream {
 
 class JETSTREAM_API Scheduler {
  public:
+    // Frame timing of an independent cluster of graphs. The budget is the
+    // period of its fastest source and is zero if no source reports one.
+    struct DeadlineStatistics {
+        F64 budget = 0.0;
+        F64 lastDuration = 0.0;
+        U64 frames = 0;
+        U64 misses = 0;
+        U64 degradedFrames = 0;
+        U64 level = 0;
+    };
+
     Result addModule(const Locale& locale, 
                      const std::shared_ptr<Module>& module,
                      const Parser::RecordMap& inputMap,
@@ -27,6 +45,33 @@ class JETSTREAM_API Scheduler {
     Result present();
     Result destroy();
 
+    void setPipelineStages(const U64& stages);
+    void setElementwiseFusion(const bool& enable);
+    void setMemoryPlanning(const bool& enable);
+    void setMaximumCatchUpFrames(const U64& frames);
+
+    // Policy of modules that only feed present modules. Blocks can
+    // override it. Everything else is critical.
+    void setDeadlinePolicy(const DeadlinePolicy& policy);
+    Result setDeadlinePolicy(const Locale& block, const DeadlinePolicy& policy);
+
+    // Number of frames computed since the scheduler was created.
+    U64 getComputedFrames() const {
+        return computedFrames;
+    }
+
+    // Frames skipped because a graph underran.
+    U64 getSkippedFrames() const {
+        return skippedFrames;
+    }
+
+    std::vector<DeadlineStatistics> getDeadlineStatistics() const;
+
+    // Modules added between these calls are planned and created together
+    // on the outermost commit. Removing a module commits pending additions.
+    Result beginTransaction();
+    Result commitTransaction();
+
     void drawDebugMessage() const;
 
  private:
@@ -34,6 +79,7 @@ class JETSTREAM_API Scheduler {
     typedef std::vector<std::pair<Device, ExecutionOrder>> DeviceExecutionOrder;
 
     struct ComputeModuleState {
+        Locale locale;
         std::shared_ptr<Compute> module;
         Parser::RecordMap inputMap;
         Parser::RecordMap outputMap;
@@ -49,12 +95,38 @@ class JETSTREAM_API Scheduler {
         Parser::RecordMap outputMap;
     };
 
+    struct FusionState {
+        ExecutionOrder blocksNames;
+        std::shared_ptr<Fusion> module;
+    };
+
+    struct DeadlineState {
+        std::vector<std::shared_ptr<Compute>> sources;
+        std::vector<U64> tasks;
+        std::shared_ptr<Throttle::Pressure> pressure;
+        bool throttled = false;
+        U64 goodFrames = 0;
+        DeadlineStatistics statistics;
+    };
+
+    struct PipelineState {
+        std::vector<std::shared_ptr<Graph>> stages;
+        std::vector<U8> validFrames;
+        U64 step = 0;
+    };
+
     std::mutex sharedMutex;
+    std::mutex presentMutex;
     std::condition_variable presentCond;
     std::condition_variable computeCond;
     bool computeSync = false;
     bool presentSync = false;
 
+    std::atomic<U64> computedFrames{0};
+    std::atomic<U64> skippedFrames{0};
+    std::atomic<Result> skippedStage{Result::SUCCESS};
+    std::atomic<U64> catchUpFrames{1};
+    Readiness readiness;
     std::atomic_flag computeWait{false};
     std::atomic_flag computeHalt{true};
     std::atomic_flag presentHalt{true};
@@ -66,14 +138,54 @@ class JETSTREAM_API Scheduler {
     std::unordered_map<std::string, PresentModuleState> validPresentModuleStates;
 
     bool running = true;
+    bool decoupledPresent = false;
     std::vector<std::shared_ptr<Graph>> graphs;
+    std::vector<std::vector<std::shared_ptr<Graph>>> clusterGraphs;
+    std::vector<Executor::Task> clusterTasks;
+    std::vector<PipelineState> pipelines;
+    std::vector<std::any> pipelinedTensors;
+    U64 pipelineStages = 1;
+    bool elementwiseFusion = false;
+    std::vector<FusionState> fusions;
+    std::unordered_map<std::string, U64> fusionIndex;
+    bool memoryPlanning = false;
+    U64 maximumCatchUpFrames = 1;
+    DeadlinePolicy deadlinePolicy = DeadlinePolicy::DECIMATE;
+    std::unordered_map<std::string, DeadlinePolicy> blockPolicies;
+    std::unordered_map<std::string, std::shared_ptr<Throttle>> throttles;
+    std::vector<DeadlineState> deadlines;
+    std::vector<F64> taskDurations;
+    mutable std::mutex deadlinesMutex;
+    std::vector<std::any> plannedTensors;
+    std::unordered_map<std::string, std::set<U64>> memoryHazards;
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    std::vector<Tensor<Device::CPU, U8>> memoryArenas;
+    std::vector<std::shared_ptr<Memory::MirroredMemory>> memoryRings;
+#endif
+    U64 transactionDepth = 0;
+    bool pendingChanges = false;
+    std::shared_ptr<Executor> executor;
     ExecutionOrder executionOrder;
     DeviceExecutionOrder deviceExecutionOrder;
 
+    Result updateExecutionPlan();
     Result removeInactive();
     Result arrangeDependencyOrder();
+    Result splitPipelineStages();
+    Result fuseElementwiseModules();
     Result checkSequenceValidity();
+    Result planMemory();
+    Result releaseMemoryPlan();
     Result createExecutionGraphs();
+    Result createPipeline(const std::vector<std::shared_ptr<Graph>>& cluster,
+                          const std::unordered_map<U64, const Parser::Record*>& outputRecords,
+                          const std::unordered_set<U64>& sourceOutputs);
+    Result releasePipelines();
+    Result computeStage(PipelineState& pipeline, const U64& stage);
+    void updateDeadlines();
+
+    // Frames on time before a degraded cluster recovers one level.
+    static constexpr U64 DeadlineRecoveryFrames = 32;
 
     Result lockState(const std::function<Result()>& func);
 };
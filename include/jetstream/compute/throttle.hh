@@ -0,0 +1,89 @@
+#ifndef JETSTREAM_COMPUTE_THROTTLE_HH
+#define JETSTREAM_COMPUTE_THROTTLE_HH
+
+#include <atomic>
+#include <memory>
+
+#include "jetstream/types.hh"
+#include "jetstream/logger.hh"
+#include "jetstream/module.hh"
+
+namespace Jetstream {
+
+// What a module gives up when its graph misses the frame deadline.
+// Critical modules always run. Dropped modules stop running while the graph
+// is behind. Decimated modules run once every 2^level frames.
+
+enum class DeadlinePolicy : uint8_t {
+    CRITICAL = 0,
+    DROP     = 1,
+    DECIMATE = 2,
+};
+
+inline const char* GetDeadlinePolicyName(const DeadlinePolicy& policy) {
+    switch (policy) {
+        case DeadlinePolicy::CRITICAL:
+            return "critical";
+        case DeadlinePolicy::DROP:
+            return "drop";
+        case DeadlinePolicy::DECIMATE:
+            return "decimate";
+    }
+    return "unknown";
+}
+
+inline DeadlinePolicy StringToDeadlinePolicy(const std::string& policy) {
+    if (policy == "drop") {
+        return DeadlinePolicy::DROP;
+    }
+    if (policy == "decimate") {
+        return DeadlinePolicy::DECIMATE;
+    }
+    return DeadlinePolicy::CRITICAL;
+}
+
+// Wraps a module and skips its compute according to the policy and to the
+// pressure of its graph. Every module of a graph shares the same pressure,
+// so a branch is either computed or skipped as a whole.
+
+class JETSTREAM_API Throttle : public Compute {
+ public:
+    struct Pressure {
+        std::atomic<U64> level{0};
+        std::atomic<U64> frame{0};
+    };
+
+    Throttle(const std::shared_ptr<Compute>& module, const DeadlinePolicy& policy);
+
+    constexpr const std::shared_ptr<Compute>& getModule() const {
+        return module;
+    }
+
+    constexpr const DeadlinePolicy& getPolicy() const {
+        return policy;
+    }
+
+    U64 getSkippedFrames() const {
+        return skippedFrames;
+    }
+
+    void setPressure(const std::shared_ptr<Pressure>& pressure);
+
+    Result createCompute(const Context& ctx) final;
+    Result compute(const Context& ctx) final;
+    Result computeReady() final;
+    Result destroyCompute(const Context& ctx) final;
+
+    // Decimated modules run at least once every 2^MaximumLevel frames.
+    static constexpr U64 MaximumLevel = 4;
+
+ private:
+    std::shared_ptr<Compute> module;
+    DeadlinePolicy policy;
+    std::shared_ptr<Pressure> pressure;
+    std::atomic<U64> skippedFrames{0};
+};
+
+}  // namespace Jetstream
+
+#endif
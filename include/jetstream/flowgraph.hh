@@ -184,6 +184,7 @@ class JETSTREAM_API Flowgraph {
     std::string _description;
 
     Result importFromBlob();    
+    Result importGraphFromBlob();
 };
 
 }  // namespace Jetstream
@@ -24,6 +24,12 @@ class JETSTREAM_API Instance {
     struct Config {
         Device preferredDevice = Device::None;
         bool enableCompositor = false;
+        bool computeOnly = false;
+        U64 pipelineStages = 1;
+        bool enableFusion = false;
+        bool enableMemoryPlanning = false;
+        U64 maximumCatchUpFrames = 1;
+        DeadlinePolicy deadlinePolicy = DeadlinePolicy::DECIMATE;
         Backend::Config backendConfig = {};
         Viewport::Config viewportConfig = {};
         Render::Window::Config renderConfig = {};
@@ -157,7 +163,7 @@ class JETSTREAM_API Instance {
         // Validate module type.
 
         if constexpr (std::is_base_of<Present, B>::value) {
-            if (!_window) {
+            if (!_window && !_computeOnly) {
                 JST_FATAL("[INSTANCE] A window is required because "
                           "a graphical module was added.");
                 return Result::FATAL;
@@ -231,6 +237,19 @@ class JETSTREAM_API Instance {
             }
         }
 
+        // Graphical modules are created but never scheduled in compute-only mode.
+
+        if constexpr (std::is_base_of<Present, B>::value) {
+            if (_computeOnly) {
+                JST_DEBUG("[INSTANCE] Skipping graphical module '{}'.", locale);
+
+                _flowgraph.nodes()[locale] = node;
+                _flowgraph.nodesOrder().push_back(locale);
+
+                return Result::SUCCESS;
+            }
+        }
+
         // Load state for present.
 
         if constexpr (std::is_base_of<Present, B>::value) {
@@ -344,9 +363,13 @@ class JETSTREAM_API Instance {
         block->config = config;
         block->input = input;
 
-        // Create block and load state.
+        // Create block and load state. Modules of the block are scheduled together.
 
-        if (block->create() != Result::SUCCESS) {
+        JST_CHECK(_scheduler.beginTransaction());
+        const Result createResult = block->create();
+        const Result commitResult = _scheduler.commitTransaction();
+
+        if (createResult != Result::SUCCESS || commitResult != Result::SUCCESS) {
             JST_DEBUG("[INSTANCE] Block '{}' is incomplete.", locale);
             block->setComplete(false);
         }
@@ -458,10 +481,12 @@ class JETSTREAM_API Instance {
 
     bool presentRunning;
     bool computeRunning;
+    bool _computeOnly = false;
 
     Result fetchDependencyTree(Locale locale, std::vector<Locale>& storage);
 
     Result blockUpdater(Locale locale, const std::function<Result(std::shared_ptr<Flowgraph::Node>&)>& updater);
+    Result recreateBlocks(Locale locale, const std::function<Result(std::shared_ptr<Flowgraph::Node>&)>& updater);
 };
 
 }  // namespace Jetstream
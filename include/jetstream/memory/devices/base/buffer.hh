@@ -6,6 +6,15 @@
 
 namespace Jetstream {
 
+// Initial content of new buffers. Buffers are cleared unless every element
+// is written before it's read, like outputs fully rewritten on each compute.
+// Only CPU buffers can skip clearing. The other devices ignore it.
+
+enum class TensorInit : uint8_t {
+    ZEROED        = 0,
+    UNINITIALIZED = 1,
+};
+
 class TensorBufferBase {
  public:
     constexpr bool allocated() const noexcept {
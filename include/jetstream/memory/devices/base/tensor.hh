@@ -28,6 +28,14 @@ class TensorBase : public TensorStorage<T> {
         buffer = this->template create_buffer<D>(ptr);
     }
 
+    TensorBase(const std::vector<U64>& shape, const TensorInit& init) : TensorStorage<T>(shape) {
+        if constexpr (D == Device::CPU) {
+            buffer = this->template create_buffer<D>(init);
+        } else {
+            buffer = this->template create_buffer<D>();
+        }
+    }
+
     template<typename... Args>
     TensorBase(const std::vector<U64>& shape, Args... args) : TensorStorage<T>(shape) {
         buffer = this->template create_buffer<D>(args...);
@@ -3,6 +3,7 @@
 
 #include <cstdlib>
 #include <memory>
+#include <vector>
 
 #include "jetstream/memory/devices/base/buffer.hh"
 
@@ -12,7 +13,8 @@ template<>
 class TensorBuffer<Device::CPU> : public TensorBufferBase {
  public:
     explicit TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
-                          const TensorPrototypeMetadata& prototype);
+                          const TensorPrototypeMetadata& prototype,
+                          const TensorInit& init = TensorInit::ZEROED);
 
     explicit TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
                           const TensorPrototypeMetadata& prototype,
@@ -44,16 +46,53 @@ class TensorBuffer<Device::CPU> : public TensorBufferBase {
     TensorBuffer(const TensorBuffer&) = delete;
     TensorBuffer& operator=(const TensorBuffer&) = delete;
 
-    constexpr const void* data() const noexcept {
-        return buffer;
+    const void* data() const noexcept {
+        return (slots.empty()) ? buffer : slots[ActiveSlot() % slots.size()];
+    }
+
+    void* data() noexcept {
+        return (slots.empty()) ? buffer : slots[ActiveSlot() % slots.size()];
+    }
+
+    // Multi-buffering is used by the pipelined scheduler to let consecutive
+    // stages work on different frames at the same time. Each thread selects
+    // which copy it sees with `SetActiveSlot`. A depth of one (or less)
+    // releases the extra copies and keeps the first one.
+
+    Result multibuffer(const U64& depth, const U64& size_bytes);
+
+    U64 depth() const noexcept {
+        return (slots.empty()) ? 1 : slots.size();
+    }
+
+    static U64 ActiveSlot() noexcept;
+    static void SetActiveSlot(const U64& slot) noexcept;
+
+    // Bit mask of the NUMA nodes new allocations are placed on. Zero
+    // leaves the placement to the operating system.
+
+    static void SetPreferredNodes(const U64& nodes) noexcept;
+
+    // Aliasing is used by the scheduler memory planner to place buffers
+    // that are only needed while a graph computes on a shared arena, and
+    // by sources handing out frames in place. The own memory is released
+    // until `unalias` allocates it again. Aliased buffers can be moved.
+
+    Result alias(void* ptr);
+    Result unalias(const U64& size_bytes);
+
+    bool aliasable() const noexcept {
+        return allocated() && slots.empty();
     }
 
-    constexpr void* data() noexcept {
-        return buffer;
+    bool aliased() const noexcept {
+        return aliasedMemory;
     }
 
  private:
     void* buffer = nullptr;
+    std::vector<void*> slots;
+    bool aliasedMemory = false;
 
 #ifdef JETSTREAM_BACKEND_VULKAN_AVAILABLE
     VkDeviceMemory vulkan_memory = VK_NULL_HANDLE;
@@ -1,6 +1,10 @@
 #ifndef JETSTREAM_MEMORY_CPU_HELPERS_HH
 #define JETSTREAM_MEMORY_CPU_HELPERS_HH
 
+#include <array>
+#include <tuple>
+#include <algorithm>
+
 #include "jetstream/types.hh"
 #include "jetstream/memory/types.hh"
 
@@ -10,200 +14,177 @@
 
 namespace Jetstream::Memory::CPU {
 
-template<class Function, class... Args>
-inline void AutomaticIterator(const Function& function, Args&... args) {
-    const U64 size = std::max({args.size()...});
-    const U64 rank = std::get<0>(std::forward_as_tuple(args...)).rank();
-
-    const auto loop = [&]<class... Iterator>(Iterator&... iter) {
-        std::array<U64, sizeof...(Args)> ptr = {args.offset()...};
-        std::array<std::array<U64, 16>, sizeof...(Args)> coords = {};
+// Innermost run of one tensor. Element `i` lives at `data[i * stride]`.
+// The stride is one for contiguous runs and zero for broadcast ones.
+
+template<typename T>
+struct Run {
+    T* data;
+    U64 stride;
+};
+
+namespace Detail {
+
+enum class Step : uint8_t {
+    UNIT,
+    BROADCAST,
+    STRIDED,
+};
+
+// Cursors carry the step in their type, so every combination of unit and
+// broadcast runs gets its own loop the compiler can vectorize.
+
+template<Step S, typename T>
+struct Cursor {
+    T* data;
+    U64 stride;
+
+    inline T& operator()(const U64& i) const __attribute__((always_inline)) {
+        if constexpr (S == Step::UNIT) {
+            return data[i];
+        } else if constexpr (S == Step::BROADCAST) {
+            return data[0];
+        } else {
+            return data[i * stride];
+        }
+    }
+};
 
-        const std::array<const U64*, sizeof...(Args)> backstride = {args.backstride().data()...};
-        const std::array<const U64*, sizeof...(Args)> shape_m1 = {args.shape_minus_one().data()...};
-        const std::array<const U64*, sizeof...(Args)> stride = {args.stride().data()...};
+template<class Function, class... Cursors>
+inline void RunKernel(const Function& function, const U64& length, const Cursors&... cursors) {
+    for (U64 i = 0; i < length; i++) {
+        function(cursors(i)...);
+    }
+}
 
-        for (U64 i = 0; i < size; i++) {
-            [&]<size_t... Is>(std::index_sequence<Is...>) __attribute__((always_inline)) {
-                function(std::get<Is>(std::forward_as_tuple(args.data()...))[ptr[Is]]...);
-            }(std::index_sequence_for<Args...>{});
+template<class Function, class... Cursors>
+inline void DispatchRuns(const Function& function, const U64& length, const std::tuple<Cursors...>& cursors) {
+    std::apply([&](const auto&... cursor) {
+        RunKernel(function, length, cursor...);
+    }, cursors);
+}
 
-            if constexpr (sizeof...(Iterator) == 1 && sizeof...(Args) > 1) {
-                for (U64 x = 0; x < sizeof...(Args); x++) {
-                    (iter(x, ptr, coords, stride, backstride, shape_m1), ...);
-                }
-            } else {
-                [&]<size_t... Is>(std::index_sequence<Is...>) __attribute__((always_inline)) {
-                    (std::get<Is>(std::forward_as_tuple(iter...))(Is, ptr, coords, stride, backstride, shape_m1), ...);
-                }(std::index_sequence_for<Iterator...>{});
-            }
-        }
+template<class Function, class... Cursors, typename T, class... Rest>
+inline void DispatchRuns(const Function& function,
+                         const U64& length,
+                         const std::tuple<Cursors...>& cursors,
+                         const Run<T>& run,
+                         const Rest&... rest) {
+    const auto next = [&]<Step S>() {
+        DispatchRuns(function, length, std::tuple_cat(cursors, std::tuple(Cursor<S, T>{run.data, run.stride})), rest...);
     };
 
-    // TODO: If the strides and offsets are the same, iterate with a single counter.
-
-    // Iterators 1D and Contiguous.
+    if (run.stride == 1) {
+        next.template operator()<Step::UNIT>();
+    } else if (run.stride == 0) {
+        next.template operator()<Step::BROADCAST>();
+    } else {
+        next.template operator()<Step::STRIDED>();
+    }
+}
 
-    const auto iterator_1d = [](const U64& i, 
-                                auto& ptr, 
-                                auto, 
-                                const auto& stride, 
-                                auto, 
-                                auto) __attribute__((always_inline)) {
-        ptr[i] += stride[i][0];
-    };
+}  // namespace Detail
 
-    const auto iterator_contiguous = [](const U64& i, 
-                                        auto& ptr, 
-                                        auto, 
-                                        auto, 
-                                        auto, 
-                                        auto) __attribute__((always_inline)) {
-        ptr[i]++;
-    };
+// Walks tensors of the same shape and hands the innermost run of each to
+// `kernel(length, Run<T>...)`. Dimensions laid out back to back in every
+// tensor are merged first, so contiguous tensors are a single run.
 
-    const auto iterator_2d = [](const U64& i, 
-                                auto& ptr, 
-                                auto& coords, 
-                                const auto& stride, 
-                                const auto& backstride, 
-                                const auto& shape_minus_one) __attribute__((always_inline)) {
-        if (coords[i][1] < shape_minus_one[i][1]) [[likely]] {
-            coords[i][1]++;
-            ptr[i] += stride[i][1];
-        } else [[unlikely]] {
-            coords[i][1] = 0;
-            coords[i][0]++;
-            ptr[i] += stride[i][0] - backstride[i][1];
-        }
-    };
+template<class Kernel, class... Args>
+inline void AutomaticSpanIterator(const Kernel& kernel, Args&... args) {
+    constexpr U64 N = sizeof...(Args);
+    constexpr U64 MaxRank = 16;
 
-    const auto iterator_3d = [](const U64& i, 
-                                auto& ptr, 
-                                auto& coords, 
-                                const auto& stride, 
-                                const auto& backstride, 
-                                const auto& shape_minus_one) __attribute__((always_inline)) {
-        for (I32 j = 2; j >= 0; j--) {
-            if (coords[i][j] < shape_minus_one[i][j]) [[likely]] {
-                coords[i][j] = coords[i][j] + 1;
-                ptr[i] += stride[i][j];
-                break;
-            } else [[unlikely]] {
-                coords[i][j] = 0;
-                ptr[i] -= backstride[i][j];
-            }
-        }
-    };
+    const auto& first = std::get<0>(std::forward_as_tuple(args...));
+    const U64 rank = first.rank();
 
-    // 1D
+    if (rank > MaxRank) {
+        JST_FATAL("Automatic iterator not implemented for rank {}.", rank);
+        JST_CHECK_THROW(Result::FATAL);
+    }
 
-    if (rank == 1) {
-        loop(iterator_1d);
+    if (std::max({args.size()...}) == 0) {
         return;
     }
 
-    // Contiguous
+    // Merge dimensions from the innermost one out.
 
-    if ((args.contiguous() && ...)) {
-        loop(iterator_contiguous);
-        return;
-    }
+    std::array<U64, MaxRank> shape = {};
+    std::array<std::array<U64, MaxRank>, N> stride = {};
+    const std::array<const std::vector<U64>*, N> strides = {&args.stride()...};
 
-    // 2D
-
-    const std::array<bool, sizeof...(Args)> contiguous = {args.contiguous()...};
-
-    if (rank == 2) {
-        if constexpr (sizeof...(Args) == 3) {
-            if (!contiguous[0] && !contiguous[1] && !contiguous[2]) {
-                loop(iterator_2d);
-                return;
-            } else if (contiguous[0] && !contiguous[1] && !contiguous[2]) {
-                loop(iterator_contiguous, iterator_2d, iterator_2d);
-                return;
-            } else if (!contiguous[0] && contiguous[1] && !contiguous[2]) {
-                loop(iterator_2d, iterator_contiguous, iterator_2d);
-                return;
-            } else if (!contiguous[0] && !contiguous[1] && contiguous[2]) {
-                loop(iterator_2d, iterator_2d, iterator_contiguous);
-                return;
-            } else if (contiguous[0] && contiguous[1] && !contiguous[2]) {
-                loop(iterator_contiguous, iterator_contiguous, iterator_2d);
-                return;
-            } else if (contiguous[0] && !contiguous[1] && contiguous[2]) {
-                loop(iterator_contiguous, iterator_2d, iterator_contiguous);
-                return;
-            } else if (!contiguous[0] && contiguous[1] && contiguous[2]) {
-                loop(iterator_2d, iterator_contiguous, iterator_contiguous);
-                return;
-            }
+    U64 dims = 0;
+    for (I64 d = static_cast<I64>(rank) - 1; d >= 0; d--) {
+        const U64 extent = first.shape()[d];
+
+        if (extent == 1) {
+            continue;
         }
 
-        if constexpr (sizeof...(Args) == 2) {
-            if (!contiguous[0] && !contiguous[1]) {
-                loop(iterator_2d);
-                return;
-            } else if (contiguous[0] && !contiguous[1]) {
-                loop(iterator_contiguous, iterator_2d);
-                return;
-            } else if (!contiguous[0] && contiguous[1]) {
-                loop(iterator_2d, iterator_contiguous);
-                return;
-            }
+        bool mergeable = dims > 0;
+        for (U64 k = 0; k < N && mergeable; k++) {
+            mergeable = (*strides[k])[d] == stride[k][dims - 1] * shape[dims - 1];
         }
 
-        loop(iterator_2d);
-        return;
+        if (mergeable) {
+            shape[dims - 1] *= extent;
+            continue;
+        }
+
+        shape[dims] = extent;
+        for (U64 k = 0; k < N; k++) {
+            stride[k][dims] = (*strides[k])[d];
+        }
+        dims += 1;
+    }
+
+    // Every dimension had an extent of one.
+
+    if (dims == 0) {
+        shape[0] = 1;
+        dims = 1;
     }
 
-    // 3D
-
-    if (rank == 3) {
-        if constexpr (sizeof...(Args) == 3) {
-            if (!contiguous[0] && !contiguous[1] && !contiguous[2]) {
-                loop(iterator_3d);
-                return;
-            } else if (contiguous[0] && !contiguous[1] && !contiguous[2]) {
-                loop(iterator_contiguous, iterator_3d, iterator_3d);
-                return;
-            } else if (!contiguous[0] && contiguous[1] && !contiguous[2]) {
-                loop(iterator_3d, iterator_contiguous, iterator_3d);
-                return;
-            } else if (!contiguous[0] && !contiguous[1] && contiguous[2]) {
-                loop(iterator_3d, iterator_3d, iterator_contiguous);
-                return;
-            } else if (contiguous[0] && contiguous[1] && !contiguous[2]) {
-                loop(iterator_contiguous, iterator_contiguous, iterator_3d);
-                return;
-            } else if (contiguous[0] && !contiguous[1] && contiguous[2]) {
-                loop(iterator_contiguous, iterator_3d, iterator_contiguous);
-                return;
-            } else if (!contiguous[0] && contiguous[1] && contiguous[2]) {
-                loop(iterator_3d, iterator_contiguous, iterator_contiguous);
-                return;
+    // Walk the outer dimensions. Index zero is the innermost one.
+
+    const U64 length = shape[0];
+    std::array<U64, N> ptr = {args.offset()...};
+    std::array<U64, MaxRank> coords = {};
+
+    while (true) {
+        [&]<size_t... Is>(std::index_sequence<Is...>) __attribute__((always_inline)) {
+            kernel(length, Run{args.data() + ptr[Is], stride[Is][0]}...);
+        }(std::index_sequence_for<Args...>{});
+
+        U64 d = 1;
+        for (; d < dims; d++) {
+            if (++coords[d] < shape[d]) {
+                for (U64 k = 0; k < N; k++) {
+                    ptr[k] += stride[k][d];
+                }
+                break;
             }
-        }
 
-        if constexpr (sizeof...(Args) == 2) {
-            if (!contiguous[0] && !contiguous[1]) {
-                loop(iterator_3d);
-                return;
-            } else if (contiguous[0] && !contiguous[1]) {
-                loop(iterator_contiguous, iterator_3d);
-                return;
-            } else if (!contiguous[0] && contiguous[1]) {
-                loop(iterator_3d, iterator_contiguous);
-                return;
+            coords[d] = 0;
+            for (U64 k = 0; k < N; k++) {
+                ptr[k] -= stride[k][d] * (shape[d] - 1);
             }
         }
 
-        loop(iterator_3d);
-        return;
+        if (d == dims) {
+            return;
+        }
     }
+}
 
-    JST_FATAL("Automatic iterator not implemented for rank {}.", rank);
-    JST_CHECK_THROW(Result::FATAL);
+// Calls `function` with the matching element of every tensor. The
+// innermost runs are dispatched to loops specialized for contiguous and
+// broadcast runs, so the compiler can vectorize them.
+
+template<class Function, class... Args>
+inline void AutomaticIterator(const Function& function, Args&... args) {
+    AutomaticSpanIterator([&](const U64& length, const auto&... runs) __attribute__((always_inline)) {
+        Detail::DispatchRuns(function, length, std::tuple<>(), runs...);
+    }, args...);
 }
 
 }  // namespace Jetstream::Memory::CPU
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "jetstream/memory/devices/base/tensor.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
 
 namespace Jetstream {
 
@@ -23,6 +24,62 @@ class Tensor<Device::CPU, T> : public TensorBase<Device::CPU, T> {
         return reinterpret_cast<T*>(this->buffer->data());
     }
 
+    Result multibuffer(const U64& depth) {
+        if (depth > 1 && this->storage->clones.size() > 1) {
+            JST_ERROR("[CPU:TENSOR] Can't multi-buffer a tensor shared with other devices.");
+            return Result::ERROR;
+        }
+        return this->buffer->multibuffer(depth, this->size_bytes());
+    }
+
+    bool aliasable() const {
+        return this->storage->clones.size() <= 1 && this->buffer->aliasable();
+    }
+
+    Result alias(void* ptr) {
+        if (this->storage->clones.size() > 1) {
+            JST_ERROR("[CPU:TENSOR] Can't alias a tensor shared with other devices.");
+            return Result::ERROR;
+        }
+        return this->buffer->alias(ptr);
+    }
+
+    Result unalias() {
+        return this->buffer->unalias(this->size_bytes());
+    }
+
+    // Contiguous tensor standing in for this view, or for an input that a
+    // module overwrites. It's filled once here and then only when
+    // `materialize` is called.
+    Tensor contiguous_copy() const {
+        Tensor copy(this->shape(), TensorInit::UNINITIALIZED);
+        copy.set_locale(this->locale());
+        copy.storage->source = *this;
+        copy.materialize();
+        return copy;
+    }
+
+    bool has_source() const {
+        return this->storage->source.has_value();
+    }
+
+    Tensor source() const {
+        return std::any_cast<Tensor>(this->storage->source);
+    }
+
+    Result materialize() {
+        if (!has_source()) {
+            return Result::SUCCESS;
+        }
+
+        auto& source = std::any_cast<Tensor&>(this->storage->source);
+        Memory::CPU::AutomaticIterator([](T& out, const T& in) {
+            out = in;
+        }, *this, source);
+
+        return Result::SUCCESS;
+    }
+
     constexpr const T& operator[](const U64& idx) const noexcept {
         return data()[idx];
     }
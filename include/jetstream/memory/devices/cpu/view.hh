@@ -0,0 +1,172 @@
+#ifndef JETSTREAM_MEMORY_CPU_VIEW_HH
+#define JETSTREAM_MEMORY_CPU_VIEW_HH
+
+#include <array>
+#include <tuple>
+#include <cassert>
+#include <utility>
+#include <type_traits>
+
+#include "jetstream/types.hh"
+#include "jetstream/logger.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
+namespace Jetstream::Memory::CPU {
+
+// Strided window over CPU memory with the rank fixed at compile time. Shape
+// and stride live in plain arrays, so narrowing a view and walking it never
+// touches the heap.
+
+template<typename T, U64 Rank>
+class TensorView {
+ public:
+    static_assert(Rank > 0, "Tensor views need at least one dimension.");
+
+    using value_type = T;
+    static constexpr U64 rank = Rank;
+
+    TensorView() = default;
+
+    TensorView(T* data, const std::array<U64, Rank>& shape, const std::array<U64, Rank>& stride)
+         : _data(data), _shape(shape), _stride(stride) {}
+
+    template<class Tensor>
+    explicit TensorView(Tensor& tensor) : _data(tensor.data() + tensor.offset()) {
+        assert(tensor.rank() == Rank);
+
+        for (U64 i = 0; i < Rank; i++) {
+            _shape[i] = tensor.shape()[i];
+            _stride[i] = tensor.stride()[i];
+        }
+    }
+
+    constexpr T* data() const noexcept {
+        return _data;
+    }
+
+    constexpr const std::array<U64, Rank>& shape() const noexcept {
+        return _shape;
+    }
+
+    constexpr const std::array<U64, Rank>& stride() const noexcept {
+        return _stride;
+    }
+
+    constexpr const U64& shape(const U64& axis) const noexcept {
+        return _shape[axis];
+    }
+
+    constexpr const U64& stride(const U64& axis) const noexcept {
+        return _stride[axis];
+    }
+
+    constexpr U64 size() const noexcept {
+        U64 size = 1;
+        for (const auto& extent : _shape) {
+            size *= extent;
+        }
+        return size;
+    }
+
+    constexpr T& operator[](const std::array<U64, Rank>& coords) const noexcept {
+        U64 index = 0;
+        for (U64 i = 0; i < Rank; i++) {
+            index += coords[i] * _stride[i];
+        }
+        return _data[index];
+    }
+
+    // Keeps `length` elements of `axis` starting at `start`.
+    constexpr TensorView slice(const U64& axis, const U64& start, const U64& length) const noexcept {
+        assert(start + length <= _shape[axis]);
+
+        TensorView view = *this;
+        view._data += start * _stride[axis];
+        view._shape[axis] = length;
+        return view;
+    }
+
+    // Repeats an axis of extent one `length` times without copying.
+    constexpr TensorView broadcast(const U64& axis, const U64& length) const noexcept {
+        assert(_shape[axis] == 1);
+
+        TensorView view = *this;
+        view._shape[axis] = length;
+        view._stride[axis] = 0;
+        return view;
+    }
+
+ private:
+    T* _data = nullptr;
+    std::array<U64, Rank> _shape = {};
+    std::array<U64, Rank> _stride = {};
+};
+
+// Calls `function` with the matching element of every view. Views must have
+// the same shape. The innermost axis goes through the specialized loops of
+// the automatic iterator and the outer ones step every pointer in place.
+
+template<class Function, class... Views>
+inline void ForEach(const Function& function, const Views&... views) {
+    const auto& first = std::get<0>(std::forward_as_tuple(views...));
+    constexpr U64 Rank = std::remove_cvref_t<decltype(first)>::rank;
+    static_assert(((Views::rank == Rank) && ...), "Views must have the same rank.");
+    assert(((views.shape() == first.shape()) && ...));
+
+    const auto& shape = first.shape();
+    for (const auto& extent : shape) {
+        if (extent == 0) {
+            return;
+        }
+    }
+
+    const U64 length = shape[Rank - 1];
+    auto data = std::tuple(views.data()...);
+    std::array<U64, Rank> coords = {};
+
+    while (true) {
+        std::apply([&](const auto&... ptrs) __attribute__((always_inline)) {
+            Detail::DispatchRuns(function, length, std::tuple<>(), Run{ptrs, views.stride(Rank - 1)}...);
+        }, data);
+
+        I64 d = static_cast<I64>(Rank) - 2;
+        for (; d >= 0; d--) {
+            if (++coords[d] < shape[d]) {
+                std::apply([&](auto&... ptrs) {
+                    ((ptrs += views.stride(d)), ...);
+                }, data);
+                break;
+            }
+
+            coords[d] = 0;
+            std::apply([&](auto&... ptrs) {
+                ((ptrs -= views.stride(d) * (shape[d] - 1)), ...);
+            }, data);
+        }
+
+        if (d < 0) {
+            return;
+        }
+    }
+}
+
+// Calls `function(std::integral_constant<U64, Rank>)` with the runtime rank
+// lifted to a constant, so kernels can build views of that rank.
+
+template<U64 MaxRank = 8, class Function>
+inline Result DispatchRank(const U64& rank, const Function& function) {
+    if (rank == 0 || rank > MaxRank) {
+        JST_ERROR("[CPU:VIEW] Tensor views not implemented for rank {}.", rank);
+        return Result::ERROR;
+    }
+
+    return [&]<U64... Is>(std::integer_sequence<U64, Is...>) {
+        Result result = Result::SUCCESS;
+        ((rank == Is + 1 && (result = function(std::integral_constant<U64, Is + 1>{}), true)) || ...);
+        return result;
+    }(std::make_integer_sequence<U64, MaxRank>{});
+}
+
+}  // namespace Jetstream::Memory::CPU
+
+#endif
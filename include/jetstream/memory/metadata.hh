@@ -73,6 +73,9 @@ struct TensorStorageMetadata {
     typedef std::unordered_map<std::string, Attribute> AttributeMap;
     AttributeMap attributes;
 
+    // View a contiguous copy is filled from. Empty for regular tensors.
+    std::any source;
+
     TensorStorageMetadata() = default;
     TensorStorageMetadata(const TensorStorageMetadata&) = delete;
     TensorStorageMetadata& operator=(const TensorStorageMetadata&) = delete;
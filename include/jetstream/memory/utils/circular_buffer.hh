@@ -8,6 +8,7 @@
 #include <complex>
 
 #include "jetstream/types.hh"
+#include "jetstream/memory/utils/overflow_policy.hh"
 
 namespace Jetstream::Memory {
 
@@ -18,6 +19,7 @@ namespace Jetstream::Memory {
  * The CircularBuffer class provides a thread-safe circular buffer that can be used to store elements of type T.
  * It supports operations like getting elements, putting elements, resetting the buffer, and resizing the buffer capacity.
  * It also provides information about the buffer's capacity, occupancy, throughput, and overflows.
+ * What happens to data that doesn't fit is selected with `setOverflowPolicy`.
  */
 template <class T>
 class CircularBuffer {
@@ -63,6 +65,9 @@ public:
 
     /**
      * @brief Put elements into the buffer.
+     * @note Blocks up to the overflow timeout with `OverflowPolicy::BLOCK`.
+     * @note Writes larger than the capacity keep their newest elements with
+     *       `OverflowPolicy::DROP_OLDEST` and fail with the other policies.
      * @param[in] data Pointer to the memory containing the elements to put.
      * @param size The number of elements to put.
      * 
@@ -70,6 +75,22 @@ public:
      */
     Result put(const T* data, const U64& size);
 
+    /**
+     * @brief Select what happens to data that doesn't fit.
+     * @param policy The overflow policy.
+     * @param timeout How long `put` waits for space with `OverflowPolicy::BLOCK`.
+     */
+    void setOverflowPolicy(const OverflowPolicy& policy,
+                           const std::chrono::milliseconds& timeout = std::chrono::milliseconds(100));
+
+    /**
+     * @brief Register a callback fired when the occupancy rises to a level.
+     * @note The callback runs on the producer thread without any lock held.
+     * @param level The occupancy that fires the callback. Zero disables it.
+     * @param callback The function to call.
+     */
+    void setWatermark(const U64& level, const WatermarkCallback& callback);
+
     /**
      * @brief Reset the buffer.
      * @return Result indicating the success or failure of the operation.
@@ -129,10 +150,38 @@ public:
         return overflows;
     }
 
+    /**
+     * @brief Get the number of elements dropped because of overflows.
+     * 
+     * @return The number of dropped elements.
+     */
+    constexpr U64 getDroppedElements() const {
+        return droppedElements;
+    }
+
+    /**
+     * @brief Get the time the producer spent waiting for space.
+     * 
+     * @return The blocked time in seconds.
+     */
+    constexpr F64 getBlockedTime() const {
+        return blockedTime;
+    }
+
+    /**
+     * @brief Get the selected overflow policy.
+     * 
+     * @return The overflow policy.
+     */
+    constexpr OverflowPolicy getOverflowPolicy() const {
+        return policy;
+    }
+
 private:
     std::mutex io_mtx;
     std::mutex sync_mtx;
     std::condition_variable semaphore;
+    std::condition_variable space;
 
     std::unique_ptr<T[]> buffer{};
 
@@ -145,6 +194,15 @@ private:
     U64 capacity;
     U64 occupancy;
     U64 overflows;
+    U64 droppedElements;
+    F64 blockedTime;
+
+    OverflowPolicy policy = OverflowPolicy::DROP_OLDEST;
+    std::chrono::milliseconds blockTimeout{100};
+
+    U64 watermark = 0;
+    bool aboveWatermark = false;
+    WatermarkCallback watermarkCallback;
 };
 
 }  // namespace Jetstream::Memory
@@ -0,0 +1,75 @@
+#ifndef JETSTREAM_MEMORY_UTILS_DISPLAY_STORAGE_H
+#define JETSTREAM_MEMORY_UTILS_DISPLAY_STORAGE_H
+
+#include <string>
+
+#include "jetstream/types.hh"
+
+namespace Jetstream::Memory {
+
+/**
+ * @enum DisplayStorage
+ * @brief How a display history stores its normalized [0, 1] values.
+ *
+ * Quantized formats are packed into 32-bit words for the shaders to unpack.
+ */
+enum class DisplayStorage : uint8_t {
+    F32 = 0,  ///< Full precision floats.
+    F16 = 1,  ///< Half precision floats. Halves the memory and upload bandwidth.
+    U8  = 2,  ///< Eight bit fixed point. Quarters the memory and upload bandwidth.
+};
+
+/**
+ * @brief Get the configuration name of a display storage.
+ */
+inline const char* GetDisplayStorageName(const DisplayStorage& storage) {
+    switch (storage) {
+        case DisplayStorage::F32:
+            return "F32";
+        case DisplayStorage::F16:
+            return "F16";
+        case DisplayStorage::U8:
+            return "U8";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Parse the configuration name of a display storage.
+ * @return The storage. Unknown names fall back to `F32`.
+ */
+inline DisplayStorage StringToDisplayStorage(const std::string& storage) {
+    if (storage == "F16") {
+        return DisplayStorage::F16;
+    }
+    if (storage == "U8") {
+        return DisplayStorage::U8;
+    }
+    return DisplayStorage::F32;
+}
+
+/**
+ * @brief Get the size in bytes of one stored value.
+ */
+inline U64 GetDisplayStorageByteSize(const DisplayStorage& storage) {
+    switch (storage) {
+        case DisplayStorage::F32:
+            return 4;
+        case DisplayStorage::F16:
+            return 2;
+        case DisplayStorage::U8:
+            return 1;
+    }
+    return 4;
+}
+
+/**
+ * @brief Get the number of 32-bit words holding `size` stored values.
+ */
+inline U64 GetDisplayStorageWords(const DisplayStorage& storage, const U64& size) {
+    return (size * GetDisplayStorageByteSize(storage) + 3) / 4;
+}
+
+}  // namespace Jetstream::Memory
+
+#endif
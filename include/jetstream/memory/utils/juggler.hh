@@ -1,22 +1,30 @@
 #ifndef JETSTREAM_MEMORY_UTILS_JUGGLER_H
 #define JETSTREAM_MEMORY_UTILS_JUGGLER_H
 
+#include <atomic>
 #include <memory>
 #include <vector>
+#include <cassert>
+#include <cstddef>
 
 #include "jetstream/types.hh"
+#include "jetstream/logger.hh"
 
 namespace Jetstream::Memory {
 
 /**
  * @class Juggler
  * @brief A class that manages a pool of shared pointers to objects of type T.
- * 
- * The Juggler class provides a way to reuse memory by maintaining a pool of shared pointers.
- * It allows objects to be allocated and deallocated efficiently, reducing the overhead of memory allocation.
- * The class provides methods to resize the pool, clear the pool, and retrieve a shared pointer from the pool.
- * Unused pointers are recycled, and unique pointers are added to the used list.
- * 
+ *
+ * The Juggler class provides a way to reuse memory by maintaining a pool of objects lent out
+ * as shared pointers. Free objects sit on a lock-free list, so lending and returning one costs
+ * the same regardless of the pool size. An object goes back to the list as soon as its last
+ * shared pointer is released. The control block of every shared pointer lives next to its
+ * object, so lending never allocates.
+ *
+ * Objects can be lent and returned from any thread. Resizing and clearing can't run
+ * concurrently with anything else. The pool must outlive the objects it lends.
+ *
  * @tparam T The type of objects managed by the Juggler.
  */
 template<typename T>
@@ -29,7 +37,7 @@ class Juggler {
 
     /**
      * @brief Constructor that resizes the pool and initializes objects.
-     * 
+     *
      * @tparam Args Variadic template parameter pack for object initialization arguments.
      * @param size The size of the pool.
      * @param args The arguments to initialize the objects.
@@ -39,9 +47,19 @@ class Juggler {
         resize(size, std::forward<Args>(args)...);
     }
 
+    /**
+     * @brief Destructor. Destroys the pooled objects.
+     */
+    ~Juggler() {
+        clear();
+    }
+
+    Juggler(const Juggler&) = delete;
+    Juggler& operator=(const Juggler&) = delete;
+
     /**
      * @brief Resizes the pool and initializes objects.
-     * 
+     *
      * @tparam Args Variadic template parameter pack for object initialization arguments.
      * @param size The new size of the pool.
      * @param args The arguments to initialize the objects.
@@ -49,64 +67,172 @@ class Juggler {
     template<typename... Args>
     void resize(const U64& size, Args&&... args) {
         clear();
-        pool.reserve(size);
-        used.reserve(size);
+
+        assert(size < IndexMask);
+
+        slots.reserve(size);
+        for (U64 i = 0; i < size; ++i) {
+            slots.push_back(std::make_unique<Slot>(args...));
+        }
+
+        // Chain every slot into the free list. Indices are one-based so zero ends the list.
         for (U64 i = 0; i < size; ++i) {
-            pool.push_back(std::make_shared<T>(std::forward<Args>(args)...));
+            slots[i]->next.store((i + 1 < size) ? i + 2 : 0, std::memory_order_relaxed);
         }
+        head.store((size > 0) ? 1 : 0, std::memory_order_release);
     }
 
     /**
      * @brief Clears the pool and used objects.
      */
     void clear() {
-        pool.clear();
-        used.clear();
+        if (inUse.load(std::memory_order_acquire) > 0) {
+            JST_WARN("[JUGGLER] Clearing pool with {} object(s) still in use.", inUse.load());
+        }
+
+        slots.clear();
+        head.store(0, std::memory_order_release);
+        inUse.store(0, std::memory_order_relaxed);
+        peakInUse.store(0, std::memory_order_relaxed);
+        exhausted.store(0, std::memory_order_relaxed);
     }
 
     /**
      * @brief Retrieves a reusable object from the pool.
-     * 
+     *
      * @return A shared pointer to the retrieved object, or nullptr if the pool is empty.
      */
     std::shared_ptr<T> get() {
-        // Recycle unused pointers.
-
-        for (auto it = used.begin(); it != used.end();) {
-            if ((*it).unique()) {
-                pool.push_back(*it);
-                it = used.erase(it);
-            } else {
-                ++it;
+        U64 current = head.load(std::memory_order_acquire);
+        U64 index = 0;
+
+        while (true) {
+            index = current & IndexMask;
+
+            if (index == 0) {
+                exhausted.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
             }
-        }
 
-        // Check if there are any pointers available.
+            // The tag changes on every update so a slot returned in the meantime is noticed.
+            const U64 next = slots[index - 1]->next.load(std::memory_order_relaxed);
+            const U64 desired = ((current & ~IndexMask) + TagIncrement) | next;
 
-        if (pool.empty()) {
-            return nullptr;
+            if (head.compare_exchange_weak(current, desired, std::memory_order_acq_rel,
+                                                             std::memory_order_acquire)) {
+                break;
+            }
         }
 
-        // Get the pointer from the pool.
+        const U64 used = inUse.fetch_add(1, std::memory_order_relaxed) + 1;
+        U64 peak = peakInUse.load(std::memory_order_relaxed);
+        while (used > peak && !peakInUse.compare_exchange_weak(peak, used, std::memory_order_relaxed)) {}
 
-        auto ptr = pool.back();
-        pool.pop_back();
+        return std::shared_ptr<T>(&slots[index - 1]->object, Keep{}, Allocator<T>(this, index));
+    }
 
-        // Add the pointer to the used list.
+    /**
+     * @brief Get the number of objects in the pool.
+     */
+    U64 getCapacity() const {
+        return slots.size();
+    }
 
-        used.push_back(ptr);
+    /**
+     * @brief Get the number of objects currently lent.
+     */
+    U64 getInUse() const {
+        return inUse.load(std::memory_order_relaxed);
+    }
 
-        // Return the pointer to caller.
+    /**
+     * @brief Get the largest number of objects lent at once.
+     */
+    U64 getPeakInUse() const {
+        return peakInUse.load(std::memory_order_relaxed);
+    }
 
-        return ptr;
+    /**
+     * @brief Get the number of requests that found the pool empty.
+     */
+    U64 getExhausted() const {
+        return exhausted.load(std::memory_order_relaxed);
     }
 
  private:
-    std::vector<std::shared_ptr<T>> pool;
-    std::vector<std::shared_ptr<T>> used;
+    static constexpr U64 IndexMask = 0xFFFFFFFF;
+    static constexpr U64 TagIncrement = U64(1) << 32;
+    static constexpr U64 ControlBlockSize = 64;
+
+    struct Slot {
+        template<typename... Args>
+        explicit Slot(Args&... args) : object(args...) {}
+
+        T object;
+        std::atomic<U64> next{0};
+        alignas(std::max_align_t) std::byte control[ControlBlockSize];
+    };
+
+    // Objects outlive their shared pointers.
+    struct Keep {
+        void operator()(T*) const {}
+    };
+
+    // Places the control block inside the slot. The slot is returned once the
+    // control block is gone, which also covers weak pointers outliving the object.
+    template<typename U>
+    struct Allocator {
+        using value_type = U;
+
+        Allocator(Juggler* pool, const U64& index) : pool(pool), index(index) {}
+
+        template<typename V>
+        Allocator(const Allocator<V>& other) : pool(other.pool), index(other.index) {}
+
+        U* allocate(const std::size_t& n) {
+            static_assert(sizeof(U) <= ControlBlockSize && alignof(U) <= alignof(std::max_align_t),
+                          "Control block doesn't fit in the slot.");
+            assert(n == 1);
+            (void)n;
+            return reinterpret_cast<U*>(pool->slots[index - 1]->control);
+        }
+
+        void deallocate(U*, const std::size_t&) {
+            pool->release(index);
+        }
+
+        template<typename V>
+        bool operator==(const Allocator<V>& other) const {
+            return pool == other.pool && index == other.index;
+        }
+
+        Juggler* pool;
+        U64 index;
+    };
+
+    void release(const U64& index) {
+        U64 current = head.load(std::memory_order_relaxed);
+
+        while (true) {
+            slots[index - 1]->next.store(current & IndexMask, std::memory_order_relaxed);
+            const U64 desired = ((current & ~IndexMask) + TagIncrement) | index;
+
+            if (head.compare_exchange_weak(current, desired, std::memory_order_release,
+                                                             std::memory_order_relaxed)) {
+                break;
+            }
+        }
+
+        inUse.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    std::vector<std::unique_ptr<Slot>> slots;
+    std::atomic<U64> head{0};
+    std::atomic<U64> inUse{0};
+    std::atomic<U64> peakInUse{0};
+    std::atomic<U64> exhausted{0};
 };
 
 }  // namespace Jetstream::Memory
 
 #endif
-
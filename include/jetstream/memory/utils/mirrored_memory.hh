@@ -0,0 +1,88 @@
+#ifndef JETSTREAM_MEMORY_UTILS_MIRRORED_MEMORY_H
+#define JETSTREAM_MEMORY_UTILS_MIRRORED_MEMORY_H
+
+#include "jetstream/types.hh"
+
+namespace Jetstream::Memory {
+
+/**
+ * @class MirroredMemory
+ * @brief Page-aligned allocation mapped twice (or more) back to back.
+ *
+ * Writing at `data() + i` also shows up at `data() + size() + i`, so any window
+ * of up to `size()` bytes starting inside the allocation is contiguous. On Linux
+ * the same memfd pages are mapped `copies()` times. Elsewhere, or if the mapping
+ * fails, a plain allocation is returned instead and `mirrored()` is false.
+ */
+class MirroredMemory {
+ public:
+    /**
+     * @brief Default constructor.
+     */
+    MirroredMemory() = default;
+
+    /**
+     * @brief Destructor. Releases the mapping.
+     */
+    ~MirroredMemory();
+
+    MirroredMemory(const MirroredMemory&) = delete;
+    MirroredMemory& operator=(const MirroredMemory&) = delete;
+
+    /**
+     * @brief Replaces the allocation with a new one.
+     * @param size The number of bytes. Has to be a multiple of `Granularity()`.
+     * @param copies How many times the pages are mapped back to back.
+     *
+     * @return Result indicating the success or failure of the operation.
+     */
+    Result allocate(const U64& size, const U64& copies = 2);
+
+    /**
+     * @brief Releases the allocation.
+     */
+    void release();
+
+    /**
+     * @brief Get the first byte of the allocation.
+     */
+    constexpr void* data() const {
+        return memory;
+    }
+
+    /**
+     * @brief Get the size of one copy in bytes.
+     */
+    constexpr U64 size() const {
+        return bytes;
+    }
+
+    /**
+     * @brief Get how many times the pages are mapped. One for plain allocations.
+     */
+    constexpr U64 copies() const {
+        return (mirror) ? mappings : 1;
+    }
+
+    /**
+     * @brief Check if the allocation is mapped more than once.
+     */
+    constexpr bool mirrored() const {
+        return mirror;
+    }
+
+    /**
+     * @brief Get the size every allocation has to be a multiple of.
+     */
+    static U64 Granularity();
+
+ private:
+    void* memory = nullptr;
+    U64 bytes = 0;
+    U64 mappings = 0;
+    bool mirror = false;
+};
+
+}  // namespace Jetstream::Memory
+
+#endif
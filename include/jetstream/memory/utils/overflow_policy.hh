@@ -0,0 +1,58 @@
+#ifndef JETSTREAM_MEMORY_UTILS_OVERFLOW_POLICY_H
+#define JETSTREAM_MEMORY_UTILS_OVERFLOW_POLICY_H
+
+#include <string>
+#include <functional>
+
+#include "jetstream/types.hh"
+
+namespace Jetstream::Memory {
+
+/**
+ * @enum OverflowPolicy
+ * @brief What a circular buffer does when the producer writes more than fits.
+ */
+enum class OverflowPolicy : uint8_t {
+    DROP_OLDEST = 0,  ///< Makes room by dropping the oldest elements.
+    DROP_NEWEST = 1,  ///< Drops the incoming elements.
+    BLOCK       = 2,  ///< Waits for the consumer up to a timeout, then drops the incoming elements.
+};
+
+/**
+ * @brief Callback fired by the producer when the occupancy rises to the watermark.
+ * @param occupancy The occupancy right after crossing it.
+ */
+typedef std::function<void(const U64& occupancy)> WatermarkCallback;
+
+/**
+ * @brief Get the configuration name of an overflow policy.
+ */
+inline const char* GetOverflowPolicyName(const OverflowPolicy& policy) {
+    switch (policy) {
+        case OverflowPolicy::DROP_OLDEST:
+            return "drop-oldest";
+        case OverflowPolicy::DROP_NEWEST:
+            return "drop-newest";
+        case OverflowPolicy::BLOCK:
+            return "block";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Parse the configuration name of an overflow policy.
+ * @return The policy. Unknown names fall back to `DROP_OLDEST`.
+ */
+inline OverflowPolicy StringToOverflowPolicy(const std::string& policy) {
+    if (policy == "drop-newest") {
+        return OverflowPolicy::DROP_NEWEST;
+    }
+    if (policy == "block") {
+        return OverflowPolicy::BLOCK;
+    }
+    return OverflowPolicy::DROP_OLDEST;
+}
+
+}  // namespace Jetstream::Memory
+
+#endif
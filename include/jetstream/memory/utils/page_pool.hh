@@ -0,0 +1,167 @@
+#ifndef JETSTREAM_MEMORY_UTILS_PAGE_POOL_H
+#define JETSTREAM_MEMORY_UTILS_PAGE_POOL_H
+
+#include <map>
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+
+#include "jetstream/types.hh"
+
+namespace Jetstream::Memory {
+
+/**
+ * @class PagePool
+ * @brief Process-wide cache of page-aligned allocations grouped in size classes.
+ *
+ * Requests are rounded up to a size class. Below eight pages every page count is
+ * its own class. Above that, each power of two is split in four classes, so at most
+ * a quarter of an allocation is wasted. Freed allocations are kept for the next
+ * request of the same class until the cache reaches its capacity. That lets whole
+ * graphs be rebuilt without going back to the operating system for every tensor.
+ *
+ * Allocations of at least `HugePageSize` bytes can be backed by huge pages. Explicit
+ * huge pages come from the reserved hugetlbfs pool and fall back to transparent
+ * ones when it's empty. Huge pages are only available on Linux.
+ *
+ * Allocations of at least `MappedSize` bytes are mapped straight from the operating
+ * system, which clears pages lazily the first time they are touched. Memory taken
+ * from the cache isn't cleared.
+ */
+class PagePool {
+ public:
+    /**
+     * @struct Config
+     * @brief Settings of the pool.
+     */
+    struct Config {
+        U64 capacity = 512*1024*1024;      ///< Bytes kept cached after being freed.
+        bool transparentHugePages = false; ///< Advise the kernel to back large allocations with huge pages.
+        bool explicitHugePages = false;    ///< Take large allocations from the reserved huge pages first.
+    };
+
+    /**
+     * @brief Size of the huge pages used for large allocations.
+     */
+    static constexpr U64 HugePageSize = 2*1024*1024;
+
+    /**
+     * @brief Size from which allocations are mapped instead of taken from the heap.
+     */
+    static constexpr U64 MappedSize = 256*1024;
+
+    /**
+     * @brief Default constructor.
+     */
+    PagePool() = default;
+
+    /**
+     * @brief Destructor. Releases the cached allocations.
+     */
+    ~PagePool();
+
+    PagePool(const PagePool&) = delete;
+    PagePool& operator=(const PagePool&) = delete;
+
+    /**
+     * @brief Get the pool shared by the whole process.
+     *
+     * It's never destroyed, so buffers can still be freed during static destruction.
+     */
+    static PagePool& Global();
+
+    /**
+     * @brief Get the size class a request is rounded up to.
+     * @param size The number of bytes requested.
+     */
+    static U64 SizeClass(const U64& size);
+
+    /**
+     * @brief Replaces the settings and drops every cached allocation.
+     * @param config The new settings.
+     */
+    void configure(const Config& config);
+
+    /**
+     * @brief Select the NUMA nodes of new allocations and drop every cached allocation.
+     * @param nodes Bit mask of the nodes. Zero leaves the placement to the operating system.
+     */
+    void setPreferredNodes(const U64& nodes);
+
+    /**
+     * @brief Returns a page-aligned allocation of at least `size` bytes.
+     * @param size The number of bytes requested.
+     *
+     * @return Pointer to the allocation. Null if the operating system is out of memory.
+     */
+    void* allocate(const U64& size);
+
+    /**
+     * @brief Returns a page-aligned allocation of at least `size` bytes.
+     * @param size The number of bytes requested.
+     * @param[out] zeroed True if the operating system guarantees the allocation reads as zero.
+     *
+     * @return Pointer to the allocation. Null if the operating system is out of memory.
+     */
+    void* allocate(const U64& size, bool& zeroed);
+
+    /**
+     * @brief Gives an allocation back to the pool.
+     * @param ptr Pointer returned by `allocate`. Null is ignored.
+     */
+    void free(void* ptr);
+
+    /**
+     * @brief Releases every cached allocation to the operating system.
+     */
+    void trim();
+
+    /**
+     * @brief Get the settings of the pool.
+     */
+    Config getConfig() const;
+
+    /**
+     * @brief Get the number of bytes cached for reuse.
+     */
+    U64 getCachedBytes() const;
+
+    /**
+     * @brief Get the number of requests served from the cache.
+     */
+    U64 getHits() const;
+
+    /**
+     * @brief Get the number of requests that went to the operating system.
+     */
+    U64 getMisses() const;
+
+ private:
+    enum class Backing : uint8_t {
+        PAGES,
+        MAPPED,
+        HUGE_PAGES,
+    };
+
+    struct Block {
+        U64 size;
+        Backing backing;
+    };
+
+    void* map(const U64& size, Backing& backing);
+    void unmap(void* ptr, const Block& block);
+
+    mutable std::mutex mutex;
+    Config config;
+    U64 preferredNodes = 0;
+
+    std::unordered_map<void*, Block> blocks;
+    std::map<U64, std::vector<void*>> cache;
+    U64 cachedBytes = 0;
+    U64 hits = 0;
+    U64 misses = 0;
+};
+
+}  // namespace Jetstream::Memory
+
+#endif
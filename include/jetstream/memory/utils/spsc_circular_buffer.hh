@@ -0,0 +1,479 @@
+#ifndef JETSTREAM_MEMORY_UTILS_SPSC_CIRCULAR_BUFFER_H
+#define JETSTREAM_MEMORY_UTILS_SPSC_CIRCULAR_BUFFER_H
+
+#include <span>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <numeric>
+#include <algorithm>
+#include <type_traits>
+
+#include "jetstream/types.hh"
+#include "jetstream/memory/utils/mirrored_memory.hh"
+#include "jetstream/memory/utils/overflow_policy.hh"
+
+namespace Jetstream::Memory {
+
+/**
+ * @class SpscCircularBuffer
+ * @brief Wait-free circular buffer for exactly one producer and one consumer thread.
+ *
+ * The producer writes in place into the span returned by `reserve` and hands it
+ * over with `commit`. The consumer reads in place from the span returned by `peek`
+ * and gives it back with `release`. Neither side takes a lock or copies data.
+ * The storage is mapped twice back to back when the platform allows it, so spans
+ * run across the end of the storage and any window of up to `getCapacity()`
+ * elements is contiguous. Otherwise spans stop at the end and a request can
+ * return fewer elements than asked for. Calling `reserve` or `peek` again after
+ * committing or releasing the first part then returns the rest.
+ *
+ * With `OverflowPolicy::DROP_OLDEST` a full buffer makes room for the incoming
+ * block by dropping the oldest elements. The consumer holds a lease on the oldest
+ * elements from `peek` until `release`. Without a lease the producer drops them
+ * itself. Otherwise it asks the consumer to drop them on `release` and waits for
+ * the room up to the same timeout as `OverflowPolicy::BLOCK`.
+ *
+ * @tparam T The type of the elements.
+ */
+template<class T>
+class SpscCircularBuffer {
+    static_assert(std::is_trivially_copyable_v<T>, "Elements are placed in raw mapped memory.");
+
+ public:
+    /**
+     * @brief Default constructor.
+     */
+    SpscCircularBuffer() = default;
+
+    /**
+     * @brief Constructor that initializes the buffer with a given capacity.
+     * @param capacity The capacity of the buffer. Element number. Not byte size.
+     */
+    explicit SpscCircularBuffer(const U64& capacity) {
+        resize(capacity);
+    }
+
+    SpscCircularBuffer(const SpscCircularBuffer&) = delete;
+    SpscCircularBuffer& operator=(const SpscCircularBuffer&) = delete;
+
+    /**
+     * @brief Replaces the storage and drops every element.
+     *
+     * Not thread-safe. Call it only while neither side is running.
+     * The capacity is rounded up to fill whole pages.
+     *
+     * @param capacity The new minimum capacity of the buffer.
+     * @return Result indicating the success or failure of the operation.
+     */
+    Result resize(const U64& capacity) {
+        const U64 step = std::lcm(MirroredMemory::Granularity(), sizeof(T)) / sizeof(T);
+        const U64 rounded = ((capacity + step - 1) / step) * step;
+
+        if (storage.allocate(rounded * sizeof(T)) != Result::SUCCESS) {
+            this->capacity = 0;
+            return Result::ERROR;
+        }
+
+        this->capacity = rounded;
+        buffer = static_cast<T*>(storage.data());
+        return reset();
+    }
+
+    /**
+     * @brief Drops every element and clears the statistics.
+     *
+     * Not thread-safe. Call it only while neither side is running.
+     *
+     * @return Result indicating the success or failure of the operation.
+     */
+    Result reset() {
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        producer = {};
+        consumer = {};
+        throughput = 0.0;
+        overflows = 0;
+        droppedElements = 0;
+        blockedNanoseconds = 0;
+        pendingDrops = 0;
+        return Result::SUCCESS;
+    }
+
+    /**
+     * @brief Select what happens to data that doesn't fit.
+     *
+     * Not thread-safe. Call it only while neither side is running.
+     *
+     * @param policy The overflow policy.
+     * @param timeout How long `reserve` waits for space with `OverflowPolicy::BLOCK`.
+     */
+    void setOverflowPolicy(const OverflowPolicy& policy,
+                           const std::chrono::milliseconds& timeout = std::chrono::milliseconds(100)) {
+        this->policy = policy;
+        this->blockTimeout = timeout;
+    }
+
+    /**
+     * @brief Register a callback fired when the occupancy rises to a level.
+     *
+     * Not thread-safe. Call it only while neither side is running.
+     * The callback runs on the producer thread.
+     *
+     * @param level The occupancy that fires the callback. Zero disables it.
+     * @param callback The function to call.
+     */
+    void setWatermark(const U64& level, const WatermarkCallback& callback) {
+        watermark = level;
+        watermarkCallback = callback;
+        producer.aboveWatermark = false;
+    }
+
+    /**
+     * @brief Returns writable space for up to `size` elements. Producer only.
+     *
+     * With `OverflowPolicy::BLOCK` a full buffer is polled until the consumer
+     * frees some space or the timeout runs out.
+     *
+     * @param size The number of elements the producer wants to write.
+     * @return Contiguous span of free elements. Empty if the buffer is full.
+     */
+    std::span<T> reserve(const U64& size) {
+        auto span = tryReserve(size);
+
+        if (!span.empty() || size == 0 || policy == OverflowPolicy::DROP_NEWEST) {
+            return span;
+        }
+
+        if (policy == OverflowPolicy::DROP_OLDEST) {
+            const U64 needed = std::min(size, capacity);
+            if (dropOldest(needed)) {
+                return tryReserve(size);
+            }
+
+            // The consumer is reading the oldest elements. It drops them on release.
+            pendingDrops.store(needed, std::memory_order_release);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const auto deadline = start + blockTimeout;
+
+        while (span.empty() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            span = tryReserve(size);
+        }
+
+        // Withdraw a request the consumer didn't get to.
+        if (policy == OverflowPolicy::DROP_OLDEST && pendingDrops.exchange(0, std::memory_order_acq_rel) == 0) {
+            span = tryReserve(size);
+        }
+
+        const auto blocked = std::chrono::steady_clock::now() - start;
+        blockedNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(blocked).count();
+
+        return span;
+    }
+
+    /**
+     * @brief Hands written elements over to the consumer. Producer only.
+     * @param size The number of elements written into the reserved span.
+     */
+    void commit(const U64& size) {
+        const U64 tail = this->tail.load(std::memory_order_relaxed) + size;
+        this->tail.store(tail, std::memory_order_release);
+
+        // Only rising edges fire the watermark.
+        if (watermark > 0) {
+            const U64 occupancy = tail - (head.load(std::memory_order_acquire) & ~Leased);
+            const bool above = occupancy >= watermark;
+            if (above && !producer.aboveWatermark && watermarkCallback) {
+                watermarkCallback(occupancy);
+            }
+            producer.aboveWatermark = above;
+        }
+    }
+
+    /**
+     * @brief Records incoming elements the producer couldn't write. Producer only.
+     * @param size The number of elements dropped.
+     */
+    void overflow(const U64& size) {
+        overflows.fetch_add(1, std::memory_order_relaxed);
+        droppedElements.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns readable data for up to `size` elements. Consumer only.
+     *
+     * The returned elements stay leased to the consumer until `release`.
+     * Elements of the span that weren't released have to be peeked again
+     * before they are read.
+     *
+     * @param size The number of elements the consumer wants to read.
+     * @return Contiguous span of the oldest elements. Empty if the buffer is empty.
+     */
+    std::span<const T> peek(const U64& size) {
+        if (capacity == 0) {
+            return {};
+        }
+
+        // The producer only moves the head while no lease is held.
+        if (!consumer.leased) {
+            U64 head = this->head.load(std::memory_order_acquire);
+            while (!this->head.compare_exchange_weak(head, head | Leased, std::memory_order_acq_rel,
+                                                                          std::memory_order_acquire)) {}
+            consumer.leased = true;
+        }
+
+        const U64 head = this->head.load(std::memory_order_relaxed) & ~Leased;
+
+        // Elements dropped by the producer can move the head past the cached tail.
+        if (consumer.cachedTail < head || consumer.cachedTail - head < size) {
+            consumer.cachedTail = tail.load(std::memory_order_acquire);
+        }
+
+        const U64 offset = head % capacity;
+        const U64 available = consumer.cachedTail - head;
+        const U64 length = std::min({size, available, contiguous(offset)});
+
+        if (length == 0) {
+            advance(head, 0);
+        }
+
+        return {buffer + offset, length};
+    }
+
+    /**
+     * @brief Gives read elements back to the producer and ends the lease. Consumer only.
+     * @param size The number of elements consumed from the peeked span.
+     */
+    void release(const U64& size) {
+        if (consumer.leased) {
+            advance(head.load(std::memory_order_relaxed) & ~Leased, size);
+        } else {
+            head.fetch_add(size, std::memory_order_release);
+        }
+
+        measure(size);
+    }
+
+    /**
+     * @brief Copies the oldest elements out of the buffer. Consumer only.
+     * @param[out] data Pointer to the memory where the elements will be stored.
+     * @param size The number of elements to get.
+     *
+     * @return Result::TIMEOUT without reading anything if fewer elements are available.
+     */
+    Result get(T* data, const U64& size) {
+        auto span = peek(size);
+        if (getOccupancy() < size) {
+            release(0);
+            return Result::TIMEOUT;
+        }
+
+        // Only the last part ends the lease, so the producer can't drop elements in between.
+        for (U64 copied = 0;;) {
+            std::copy(span.begin(), span.end(), data + copied);
+            copied += span.size();
+
+            if (copied == size) {
+                release(span.size());
+                return Result::SUCCESS;
+            }
+
+            const U64 head = this->head.load(std::memory_order_relaxed) & ~Leased;
+            this->head.store((head + span.size()) | Leased, std::memory_order_release);
+            measure(span.size());
+
+            span = peek(size - copied);
+        }
+    }
+
+    /**
+     * @brief Check if spans can run across the end of the storage.
+     */
+    constexpr bool isMirrored() const {
+        return storage.mirrored();
+    }
+
+    /**
+     * @brief Get the capacity of the buffer.
+     */
+    constexpr U64 getCapacity() const {
+        return capacity;
+    }
+
+    /**
+     * @brief Get the number of elements waiting for the consumer.
+     *
+     * Exact on the consumer thread. A lower bound on every other thread.
+     */
+    U64 getOccupancy() const {
+        const U64 head = this->head.load(std::memory_order_acquire) & ~Leased;
+        return tail.load(std::memory_order_acquire) - head;
+    }
+
+    /**
+     * @brief Check if the buffer is empty.
+     */
+    bool isEmpty() const {
+        return getOccupancy() == 0;
+    }
+
+    /**
+     * @brief Check if the buffer is full.
+     */
+    bool isFull() const {
+        return getOccupancy() == getCapacity();
+    }
+
+    /**
+     * @brief Get the number of elements released per second.
+     */
+    F64 getThroughput() const {
+        return throughput;
+    }
+
+    /**
+     * @brief Get the number of times data was dropped.
+     */
+    U64 getOverflows() const {
+        return overflows;
+    }
+
+    /**
+     * @brief Get the number of elements dropped because of overflows.
+     */
+    U64 getDroppedElements() const {
+        return droppedElements;
+    }
+
+    /**
+     * @brief Get the time the producer spent waiting for space in seconds.
+     */
+    F64 getBlockedTime() const {
+        return blockedNanoseconds / 1e9;
+    }
+
+    /**
+     * @brief Get the selected overflow policy.
+     */
+    constexpr OverflowPolicy getOverflowPolicy() const {
+        return policy;
+    }
+
+ private:
+    std::span<T> tryReserve(const U64& size) {
+        if (capacity == 0) {
+            return {};
+        }
+
+        const U64 tail = this->tail.load(std::memory_order_relaxed);
+
+        if (capacity - (tail - producer.cachedHead) < size) {
+            producer.cachedHead = head.load(std::memory_order_acquire) & ~Leased;
+        }
+
+        const U64 offset = tail % capacity;
+        const U64 free = capacity - (tail - producer.cachedHead);
+        return {buffer + offset, std::min({size, free, contiguous(offset)})};
+    }
+
+    // Drops the oldest elements for the producer while nobody leases them.
+    bool dropOldest(const U64& size) {
+        U64 head = this->head.load(std::memory_order_acquire);
+
+        while ((head & Leased) == 0) {
+            const U64 dropped = std::min(size, tail.load(std::memory_order_relaxed) - head);
+            if (this->head.compare_exchange_weak(head, head + dropped, std::memory_order_acq_rel,
+                                                                       std::memory_order_acquire)) {
+                overflows.fetch_add(1, std::memory_order_relaxed);
+                droppedElements.fetch_add(dropped, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Moves the head past released elements and ends the lease. Drops
+    // whatever the waiting producer still needs on the way.
+    void advance(const U64& head, const U64& size) {
+        U64 next = head + size;
+
+        const U64 needed = pendingDrops.exchange(0, std::memory_order_acq_rel);
+        if (needed > 0) {
+            const U64 tail = this->tail.load(std::memory_order_acquire);
+            const U64 free = capacity - (tail - next);
+            const U64 dropped = (needed > free) ? std::min(needed - free, tail - next) : 0;
+
+            if (dropped > 0) {
+                next += dropped;
+                overflows.fetch_add(1, std::memory_order_relaxed);
+                droppedElements.fetch_add(dropped, std::memory_order_relaxed);
+            }
+        }
+
+        this->head.store(next, std::memory_order_release);
+        consumer.leased = false;
+    }
+
+    void measure(const U64& size) {
+        const auto now = std::chrono::steady_clock::now();
+        const std::chrono::duration<F64> elapsed = now - consumer.lastUpdate;
+
+        consumer.transfers += size;
+        if (elapsed.count() > 0.5) {
+            throughput = consumer.transfers / elapsed.count();
+            consumer.transfers = 0;
+            consumer.lastUpdate = now;
+        }
+    }
+
+    U64 contiguous(const U64& offset) const {
+        return (storage.mirrored()) ? capacity : (capacity - offset);
+    }
+
+    // Each side keeps a stale copy of the other side's counter and only
+    // reloads it when it looks like there isn't enough room. The counters
+    // never wrap and live on separate cache lines. The top bit of the head
+    // marks the consumer's lease.
+
+    static constexpr U64 Leased = U64(1) << 63;
+
+    struct alignas(64) ProducerState {
+        U64 cachedHead = 0;
+        bool aboveWatermark = false;
+    };
+
+    struct alignas(64) ConsumerState {
+        U64 cachedTail = 0;
+        U64 transfers = 0;
+        bool leased = false;
+        std::chrono::steady_clock::time_point lastUpdate = std::chrono::steady_clock::now();
+    };
+
+    MirroredMemory storage;
+    T* buffer = nullptr;
+    U64 capacity = 0;
+
+    alignas(64) std::atomic<U64> head{0};
+    alignas(64) std::atomic<U64> tail{0};
+    ProducerState producer;
+    ConsumerState consumer;
+
+    std::atomic<F64> throughput{0.0};
+    std::atomic<U64> overflows{0};
+    std::atomic<U64> droppedElements{0};
+    std::atomic<U64> blockedNanoseconds{0};
+    std::atomic<U64> pendingDrops{0};
+
+    OverflowPolicy policy = OverflowPolicy::DROP_OLDEST;
+    std::chrono::milliseconds blockTimeout{100};
+    U64 watermark = 0;
+    WatermarkCallback watermarkCallback;
+};
+
+}  // namespace Jetstream::Memory
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef JETSTREAM_MEMORY_UTILS_TRIPLE_BUFFER_H
+#define JETSTREAM_MEMORY_UTILS_TRIPLE_BUFFER_H
+
+#include <array>
+#include <atomic>
+
+#include "jetstream/types.hh"
+
+namespace Jetstream::Memory {
+
+/**
+ * @class TripleBuffer
+ * @brief Lock-free handoff of the latest value from one producer to one consumer.
+ *
+ * The producer fills the write slot and publishes it. The consumer picks up
+ * the most recently published slot. One slot is always owned by each side and
+ * the third one sits in the middle, so neither side ever waits for the other.
+ * Values published while the consumer is busy are overwritten by newer ones.
+ *
+ * @tparam T The type of the values being handed over.
+ */
+template<typename T>
+class TripleBuffer {
+ public:
+    /**
+     * @brief Default constructor.
+     */
+    TripleBuffer() = default;
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /**
+     * @brief Replaces every slot with a new object and drops unread values.
+     *
+     * Not thread-safe. Call it only while neither side is running.
+     *
+     * @tparam Args Variadic template parameter pack for object initialization arguments.
+     * @param args The arguments to initialize the objects.
+     */
+    template<typename... Args>
+    void reset(const Args&... args) {
+        for (auto& slot : slots) {
+            slot = T(args...);
+        }
+        writeIndex = 0;
+        middleIndex.store(1, std::memory_order_relaxed);
+        readIndex = 2;
+    }
+
+    /**
+     * @brief Returns the slot owned by the producer.
+     */
+    T& getWriteSlot() {
+        return slots[writeIndex];
+    }
+
+    /**
+     * @brief Hands the write slot over to the consumer.
+     *
+     * The producer receives the previous middle slot as its new write slot.
+     */
+    void publish() {
+        const U8 previous = middleIndex.exchange(writeIndex | FreshBit, std::memory_order_acq_rel);
+        writeIndex = previous & IndexMask;
+    }
+
+    /**
+     * @brief Takes the latest published slot, if any.
+     *
+     * @return True if the read slot changed since the last call.
+     */
+    bool consume() {
+        if ((middleIndex.load(std::memory_order_relaxed) & FreshBit) == 0) {
+            return false;
+        }
+        const U8 previous = middleIndex.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & IndexMask;
+        return true;
+    }
+
+    /**
+     * @brief Returns the slot owned by the consumer.
+     */
+    const T& getReadSlot() const {
+        return slots[readIndex];
+    }
+
+ private:
+    static constexpr U8 IndexMask = 0b011;
+    static constexpr U8 FreshBit = 0b100;
+
+    std::array<T, 3> slots;
+    U8 writeIndex = 0;
+    std::atomic<U8> middleIndex{1};
+    U8 readIndex = 2;
+};
+
+}  // namespace Jetstream::Memory
+
+#endif
@@ -1,12 +1,16 @@
 #ifndef JETSTREAM_MODULE_HH
 #define JETSTREAM_MODULE_HH
 
+#include <atomic>
+#include <limits>
+
 #include "jetstream/types.hh"
 #include "jetstream/macros.hh"
 #include "jetstream/logger.hh"
 #include "jetstream/benchmark.hh"
 #include "jetstream/render/base.hh"
 #include "jetstream/memory/base.hh"
+#include "jetstream/compute/readiness.hh"
 
 namespace Jetstream {
 
@@ -53,7 +57,29 @@ class JETSTREAM_API Module {
             return Result::ERROR;
         }
 
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+        // Other readers of the input keep its data. The scheduler refreshes
+        // the copy before every compute.
+        if constexpr (DeviceId == Device::CPU) {
+            if ((taint & Taint::IN_PLACE) == Taint::IN_PLACE) {
+                JST_DEBUG("[MODULE] Input '{}' is overwritten in place. Working on a copy.", buffer.locale());
+                buffer = buffer.contiguous_copy();
+                return Result::SUCCESS;
+            }
+        }
+#endif
+
         if ((taint & Taint::DISCONTIGUOUS) != Taint::DISCONTIGUOUS && !buffer.contiguous()) {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+            // The scheduler refreshes the copy before every compute.
+            if constexpr (DeviceId == Device::CPU) {
+                JST_DEBUG("[MODULE] Input '{}' isn't contiguous. Reading it through a contiguous copy.",
+                          buffer.locale());
+                buffer = buffer.contiguous_copy();
+                return Result::SUCCESS;
+            }
+#endif
+
             JST_ERROR("Input is not contiguous during initialization.");
             return Result::ERROR;
         }
@@ -99,6 +125,7 @@ class JETSTREAM_API Module {
 class CPU;
 class CUDA;
 class Metal;
+class Scheduler;
 
 class JETSTREAM_API Compute {
  public:
@@ -120,15 +147,55 @@ class JETSTREAM_API Compute {
         return Result::SUCCESS;
     }
     virtual constexpr Result compute(const Context& ctx) = 0;
+
+    // Sources without enough data return Result::TIMEOUT instead of
+    // blocking and call `notifyReady` once they have it.
     virtual constexpr Result computeReady() {
         return Result::SUCCESS;
     }
+
+    // Number of frames a source can produce after the next one without
+    // waiting. Modules that aren't sources never limit the catch-up.
+    virtual constexpr U64 computeBacklog() const {
+        return std::numeric_limits<U64>::max();
+    }
+
+    // Seconds a source takes to produce one frame. Zero if unknown.
+    virtual constexpr F64 computePeriod() const {
+        return 0.0;
+    }
     virtual constexpr Result destroyCompute(const Context&) {
         return Result::SUCCESS;
     }
 
+    // Elementwise modules can compute any range of their flattened output.
+    // Ranges start at an even element. Used by the scheduler to fuse them.
+    virtual constexpr bool elementwise() const {
+        return false;
+    }
+    virtual constexpr Result computeRange(const Context&, const U64&, const U64&) {
+        return Result::ERROR;
+    }
+
+    // True if every compute call rewrites all outputs without reading them
+    // back. Such outputs don't need to persist and can share memory.
+    virtual constexpr bool transientOutputs() const {
+        return elementwise();
+    }
+
  protected:
+    void notifyReady() const {
+        if (auto* ready = readiness.load()) {
+            ready->notify();
+        }
+    }
+
     friend Instance;
+
+ private:
+    std::atomic<Readiness*> readiness{nullptr};
+
+    friend Scheduler;
 };
 
 class JETSTREAM_API Present {
@@ -143,6 +210,12 @@ class JETSTREAM_API Present {
         return Result::SUCCESS;
     }
 
+    // True if present() only reads state handed over by compute through
+    // lock-free snapshots. Such modules are presented while compute runs.
+    virtual constexpr bool decoupledPresent() const {
+        return false;
+    }
+
  protected:
     std::shared_ptr<Render::Window> window;
 
@@ -81,12 +81,17 @@ class Amplitude : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    bool elementwise() const final;
+    Result computeRange(const Context& ctx, const U64& begin, const U64& end) final;
+    Result computeElementwise(const U64& begin, const U64& end);
+
  private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
 
     F32 scalingCoeff = 0.0f;
     U64 numberOfElements = 0;
+    U64 numberOfBatches = 0;
 
     JST_DEFINE_IO()
 };
@@ -12,7 +12,9 @@
 namespace Jetstream {
 
 #define JST_CAST_CPU(MACRO) \
-    MACRO(Cast, CPU, F32, I16)
+    MACRO(Cast, CPU, F32, I16) \
+    MACRO(Cast, CPU, CI16, CF32) \
+    MACRO(Cast, CPU, CI8, CF32)
 
 template<Device D, typename IT = F32, typename OT = I16>
 class Cast : public Module, public Compute {
@@ -73,6 +75,10 @@ class Cast : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    bool elementwise() const final;
+    Result computeRange(const Context& ctx, const U64& begin, const U64& end) final;
+    Result computeElementwise(const U64& begin, const U64& end);
+
     JST_DEFINE_IO()
 };
 
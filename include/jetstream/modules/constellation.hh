@@ -6,6 +6,7 @@
 #include "jetstream/types.hh"
 
 #include "jetstream/memory/base.hh"
+#include "jetstream/memory/utils/triple_buffer.hh"
 #include "jetstream/render/base.hh"
 #include "jetstream/render/extras.hh"
 #include "jetstream/compute/graph/base.hh"
@@ -83,6 +84,7 @@ class Constellation : public Module, public Compute, public Present {
     Result createPresent() final;
     Result present() final;
     Result destroyPresent() final;
+    bool decoupledPresent() const final;
 
  private:
     struct Impl;
@@ -92,6 +94,8 @@ class Constellation : public Module, public Compute, public Present {
     std::unique_ptr<GImpl> gimpl;
 
     Tensor<D, F32> timeSamples;
+    Tensor<D, F32> signalSamples;
+    Memory::TripleBuffer<Tensor<D, F32>> timeSnapshots;
 
     std::shared_ptr<Render::Buffer> fillScreenVerticesBuffer;
     std::shared_ptr<Render::Buffer> fillScreenTextureVerticesBuffer;
@@ -83,6 +83,8 @@ class FFT : public Module, public Compute {
     Result destroyCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    bool transientOutputs() const final;
+
  private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
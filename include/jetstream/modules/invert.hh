@@ -70,6 +70,10 @@ class Invert : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    bool elementwise() const final;
+    Result computeRange(const Context& ctx, const U64& begin, const U64& end) final;
+    Result computeElementwise(const U64& begin, const U64& end);
+
     JST_DEFINE_IO()
 };
 
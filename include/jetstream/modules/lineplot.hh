@@ -6,6 +6,7 @@
 #include "jetstream/types.hh"
 
 #include "jetstream/memory/base.hh"
+#include "jetstream/memory/utils/triple_buffer.hh"
 #include "jetstream/render/base.hh"
 #include "jetstream/render/extras.hh"
 #include "jetstream/compute/graph/base.hh"
@@ -116,6 +117,7 @@ class Lineplot : public Module, public Compute, public Present {
     Result createPresent() final;
     Result present() final;
     Result destroyPresent() final;
+    bool decoupledPresent() const final;
 
  private:
     struct Impl;
@@ -125,6 +127,7 @@ class Lineplot : public Module, public Compute, public Present {
     std::unique_ptr<GImpl> gimpl;
 
     Tensor<D, F32> signalPoints;
+    Memory::TripleBuffer<Tensor<D, F32>> signalSnapshots;
     Tensor<D, F32> signalVertices;
     Tensor<Device::CPU, F32> gridPoints;
     Tensor<D, F32> gridVertices;
@@ -84,12 +84,25 @@ class Multiply : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    bool elementwise() const final;
+    bool transientOutputs() const final;
+    Result computeRange(const Context& ctx, const U64& begin, const U64& end) final;
+    Result computeElementwise(const U64& begin, const U64& end);
+
  private:
     Tensor<D, T> a;
     Tensor<D, T> b;
     Tensor<D, T> c;
+    bool elementwiseFactors = false;
 
     // TODO: Remove backend specific code from header in favor of `pimpl->`.
+#ifdef JETSTREAM_MODULE_MULTIPLY_CPU_AVAILABLE
+    struct {
+        std::vector<Tensor<Device::CPU, T>> a;
+        std::vector<Tensor<Device::CPU, T>> b;
+        std::vector<Tensor<Device::CPU, T>> c;
+    } cpu;
+#endif
 #ifdef JETSTREAM_MODULE_MULTIPLY_METAL_AVAILABLE
     struct {
         MTL::ComputePipelineState* state;
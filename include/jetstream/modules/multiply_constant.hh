@@ -77,6 +77,10 @@ class MultiplyConstant : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    bool elementwise() const final;
+    Result computeRange(const Context& ctx, const U64& begin, const U64& end) final;
+    Result computeElementwise(const U64& begin, const U64& end);
+
  private:
     // TODO: Remove backend specific code from header in favor of `pimpl->`.
 #ifdef JETSTREAM_MODULE_MULTIPLY_METAL_AVAILABLE
@@ -119,6 +119,7 @@ class Remote : public Module, public Present {
     Result createPresent() final;
     Result present() final;
     Result destroyPresent() final;
+    bool decoupledPresent() const final;
 
  private:
     // Gstreamer.
@@ -89,6 +89,10 @@ class Scale : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
 
+    bool elementwise() const final;
+    Result computeRange(const Context& ctx, const U64& begin, const U64& end) final;
+    Result computeElementwise(const U64& begin, const U64& end);
+
  private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
@@ -96,6 +100,7 @@ class Scale : public Module, public Compute {
     F32 scalingCoeff;
     F32 offsetCoeff;
     U64 numberOfElements;
+    U64 numberOfBatches;
 
     JST_DEFINE_IO()
 };
@@ -2,19 +2,22 @@
 #define JETSTREAM_MODULES_SOAPY_HH
 
 #include <thread>
+#include <atomic>
 
 #include "jetstream/logger.hh"
 #include "jetstream/module.hh"
 #include "jetstream/types.hh"
 
 #include "jetstream/memory/base.hh"
-#include "jetstream/memory/utils/circular_buffer.hh"
+#include "jetstream/memory/utils/spsc_circular_buffer.hh"
 #include "jetstream/compute/graph/base.hh"
 
 namespace Jetstream {
 
 #define JST_SOAPY_CPU(MACRO) \
-    MACRO(Soapy, CPU, CF32)
+    MACRO(Soapy, CPU, CF32) \
+    MACRO(Soapy, CPU, CI16) \
+    MACRO(Soapy, CPU, CI8)
 
 template<Device D, typename T = CF32>
 class Soapy : public Module, public Compute {
@@ -45,11 +48,13 @@ class Soapy : public Module, public Compute {
         U64 numberOfBatches = 8;
         U64 numberOfTimeSamples = 8192;
         U64 bufferMultiplier = 4;
+        std::string overflowPolicy = "drop-oldest";
+        F32 bufferWatermark = 0.75;
 
         JST_SERDES(deviceString, streamString,
                    frequency, sampleRate, automaticGain, 
                    numberOfBatches, numberOfTimeSamples, 
-                   bufferMultiplier);
+                   bufferMultiplier, overflowPolicy, bufferWatermark);
     };
 
     constexpr const Config& getConfig() const {
@@ -97,7 +102,7 @@ class Soapy : public Module, public Compute {
 
     // Miscellaneous
 
-    constexpr Memory::CircularBuffer<T>& getCircularBuffer() {
+    constexpr Memory::SpscCircularBuffer<T>& getCircularBuffer() {
         return buffer;
     }
 
@@ -123,6 +128,8 @@ class Soapy : public Module, public Compute {
     Result createCompute(const Context& ctx) final;
     Result compute(const Context& ctx) final;
     Result computeReady() final;
+    U64 computeBacklog() const final;
+    F64 computePeriod() const final;
 
  private:
     struct Impl;
@@ -134,7 +141,8 @@ class Soapy : public Module, public Compute {
     std::string deviceLabel;
     std::string deviceName;
     std::string deviceHardwareKey;
-    Memory::CircularBuffer<T> buffer;
+    Memory::SpscCircularBuffer<T> buffer;
+    std::atomic<U64> borrowedSamples{0};
     Tensor<Device::CPU, T> hostOutputBuffer;
 
     Result soapyThreadLoop();
@@ -6,6 +6,7 @@
 #include "jetstream/types.hh"
 
 #include "jetstream/memory/base.hh"
+#include "jetstream/memory/utils/display_storage.hh"
 #include "jetstream/render/base.hh"
 #include "jetstream/render/extras.hh"
 #include "jetstream/compute/graph/base.hh"
@@ -32,8 +33,9 @@ class Spectrogram : public Module, public Compute, public Present {
     struct Config {
         U64 height = 256;
         Size2D<U64> viewSize = {512, 384};
+        std::string storage = "F32";
 
-        JST_SERDES(height, viewSize);
+        JST_SERDES(height, viewSize, storage);
     };
     
     constexpr const Config& getConfig() const {
@@ -98,7 +100,12 @@ class Spectrogram : public Module, public Compute, public Present {
     struct GImpl;
     std::unique_ptr<GImpl> gimpl;
 
+    Result computeQuantized(const Context& ctx);
+
     Tensor<D, F32> frequencyBins;
+    Tensor<D, U32> halfBins;
+    Tensor<D, U32> packedBins;
+    Memory::DisplayStorage displayStorage = Memory::DisplayStorage::F32;
 
     std::shared_ptr<Render::Buffer> fillScreenVerticesBuffer;
     std::shared_ptr<Render::Buffer> fillScreenTextureVerticesBuffer;
@@ -6,6 +6,7 @@
 #include "jetstream/types.hh"
 
 #include "jetstream/memory/base.hh"
+#include "jetstream/memory/utils/display_storage.hh"
 #include "jetstream/render/base.hh"
 #include "jetstream/render/extras.hh"
 #include "jetstream/compute/graph/base.hh"
@@ -35,8 +36,9 @@ class Waterfall : public Module, public Compute, public Present {
         U64 height = 512;
         bool interpolate = true;
         Size2D<U64> viewSize = {512, 384};
+        std::string storage = "F32";
 
-        JST_SERDES(zoom, offset, height, interpolate, viewSize);
+        JST_SERDES(zoom, offset, height, interpolate, viewSize, storage);
     };
 
     constexpr const Config& getConfig() const {
@@ -108,6 +110,7 @@ class Waterfall : public Module, public Compute, public Present {
     Result createPresent() final;
     Result present() final;
     Result destroyPresent() final;
+    bool decoupledPresent() const final;
 
  private:
     struct Impl;
@@ -117,6 +120,8 @@ class Waterfall : public Module, public Compute, public Present {
     std::unique_ptr<GImpl> gimpl;
 
     Tensor<D, F32> frequencyBins;
+    Tensor<D, U32> packedBins;
+    Memory::DisplayStorage displayStorage = Memory::DisplayStorage::F32;
 
     std::shared_ptr<Render::Buffer> fillScreenVerticesBuffer;
     std::shared_ptr<Render::Buffer> fillScreenTextureVerticesBuffer;
@@ -137,7 +142,8 @@ class Waterfall : public Module, public Compute, public Present {
 
     U64 numberOfElements = 0;
     U64 numberOfBatches = 0;
-    int inc = 0, last = 0, ymax = 0;
+    std::atomic<int> inc{0};
+    int last = 0, ymax = 0;
 
     Result underlyingCompute(const Context& ctx);
 
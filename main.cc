@@ -1,9 +1,24 @@
 #include <thread>
+#include <atomic>
+#include <csignal>
+#include <sstream>
 
 #include "jetstream/base.hh"
 
 using namespace Jetstream;
 
+static std::atomic<bool> keepComputing = true;
+
+static std::vector<U64> ParseCores(const std::string& list) {
+    std::vector<U64> cores;
+    std::stringstream stream(list);
+    std::string core;
+    while (std::getline(stream, core, ',')) {
+        cores.push_back(std::stoul(core));
+    }
+    return cores;
+}
+
 int main(int argc, char* argv[]) {
     // Parse command line arguments.
 
@@ -12,6 +27,12 @@ int main(int argc, char* argv[]) {
     Render::Window::Config renderConfig;
     std::string flowgraphPath;
     Device prefferedBackend = Device::None;
+    U64 pipelineStages = 1;
+    bool enableFusion = false;
+    bool enableMemoryPlanning = false;
+    bool computeOnly = false;
+    U64 maximumCatchUpFrames = 1;
+    DeadlinePolicy deadlinePolicy = DeadlinePolicy::DECIMATE;
 
     for (int i = 1; i < argc; i++) {
         const std::string arg = std::string(argv[i]);
@@ -22,6 +43,12 @@ int main(int argc, char* argv[]) {
             continue;
         }
 
+        if (arg == "--compute-only") {
+            computeOnly = true;
+
+            continue;
+        }
+
         if (arg == "--endpoint") {
             if (i + 1 < argc) {
                 viewportConfig.endpoint = argv[++i];
@@ -123,6 +150,110 @@ int main(int argc, char* argv[]) {
             continue;
         }
 
+        if (arg == "--pipeline") {
+            if (i + 1 < argc) {
+                pipelineStages = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--fusion") {
+            enableFusion = true;
+
+            continue;
+        }
+
+        if (arg == "--memory-planning") {
+            enableMemoryPlanning = true;
+
+            continue;
+        }
+
+        if (arg == "--catch-up") {
+            if (i + 1 < argc) {
+                maximumCatchUpFrames = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--deadline-policy") {
+            if (i + 1 < argc) {
+                deadlinePolicy = StringToDeadlinePolicy(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--threads") {
+            if (i + 1 < argc) {
+                backendConfig.computeThreads = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--compute-cores") {
+            if (i + 1 < argc) {
+                backendConfig.computeCores = ParseCores(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--io-cores") {
+            if (i + 1 < argc) {
+                backendConfig.ioCores = ParseCores(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--realtime") {
+            if (i + 1 < argc) {
+                backendConfig.threadPolicy = Backend::StringToThreadPolicy(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--realtime-priority") {
+            if (i + 1 < argc) {
+                backendConfig.threadPriority = std::stoul(argv[++i]);
+            }
+
+            continue;
+        }
+
+        if (arg == "--lock-memory") {
+            backendConfig.lockMemory = true;
+
+            continue;
+        }
+
+        if (arg == "--numa-local") {
+            backendConfig.numaLocalMemory = true;
+
+            continue;
+        }
+
+        if (arg == "--memory-pool-size") {
+            if (i + 1 < argc) {
+                backendConfig.memoryPoolSize = std::stoul(argv[++i]) * 1024 * 1024;
+            }
+
+            continue;
+        }
+
+        if (arg == "--huge-pages") {
+            if (i + 1 < argc) {
+                backendConfig.hugePages = Backend::StringToHugePages(argv[++i]);
+            }
+
+            continue;
+        }
+
         if (arg == "--scale") {
             if (i + 1 < argc) {
                 renderConfig.scale = std::stof(argv[++i]);
@@ -135,6 +266,7 @@ int main(int argc, char* argv[]) {
             std::cout << "Usage: " << argv[0] << " [options] [flowgraph]" << std::endl;
             std::cout << "Options:" << std::endl;
             std::cout << "  --headless              Enable headless mode." << std::endl;
+            std::cout << "  --compute-only          Run the flowgraph without any viewport or rendering and report the frame rate at exit." << std::endl;
             std::cout << "  --endpoint [endpoint]   Set the endpoint of the headless viewport (`1.1.1.1:8000`, `./vid.mp4`, etc). Default: `/tmp/cyberether`" << std::endl;
             std::cout << "  --backend [backend]     Set the preferred backend (`Metal`, `Vulkan`, or `WebGPU`)." << std::endl;
             std::cout << "  --framerate [value]     Set the framerate of the headless viewport (FPS). Default: `60`" << std::endl;
@@ -144,11 +276,25 @@ int main(int argc, char* argv[]) {
             std::cout << "  --scale [scale]         Set the scale of the render window. Default: `1.0`" << std::endl;
             std::cout << "  --benchmark [type]      Run the benchmark and output the results (`markdown`, `json`, or `csv`). Default: `markdown`" << std::endl;
             std::cout << "  --no-hw-acceleration    Disable hardware acceleration. Enabled otherwise." << std::endl;
+            std::cout << "  --pipeline [stages]     Split CPU graphs into pipeline stages running concurrently. Default: `1`" << std::endl;
+            std::cout << "  --threads [count]       Set the number of CPU compute threads. Default: one per core" << std::endl;
+            std::cout << "  --fusion                Fuse chains of elementwise CPU blocks into a single pass. Disabled otherwise." << std::endl;
+            std::cout << "  --memory-planning       Share memory between CPU Vectors with disjoint lifetimes. Disabled otherwise." << std::endl;
+            std::cout << "  --catch-up [frames]     Compute up to this many already buffered frames per wake-up. Default: `1`" << std::endl;
+            std::cout << "  --deadline-policy [policy] Degrade present-only blocks on missed deadlines (`critical`, `drop`, `decimate`). Default: `decimate`" << std::endl;
             std::cout << "Other Options:" << std::endl;
             std::cout << "  --staging-buffer [size] Set the staging buffer size (MB). Default: `64`" << std::endl;
             std::cout << "  --device-id [id]        Set the physical device ID. Default: `0`" << std::endl;
             std::cout << "  --no-validation         Disable Vulkan validation layers. Enabled otherwise." << std::endl;
             std::cout << "  --no-vsync              Disable vsync. Enabled otherwise." << std::endl;
+            std::cout << "  --compute-cores [list]  Pin compute threads to these cores, one each (`2,3,4`). Default: unpinned" << std::endl;
+            std::cout << "  --io-cores [list]       Pin device threads to these cores (`0,1`). Default: unpinned" << std::endl;
+            std::cout << "  --realtime [policy]     Run compute and device threads with real-time scheduling (`fifo` or `rr`)." << std::endl;
+            std::cout << "  --realtime-priority [value] Set the real-time priority of compute threads. Default: `1`" << std::endl;
+            std::cout << "  --lock-memory           Lock all memory in RAM. Disabled otherwise." << std::endl;
+            std::cout << "  --numa-local            Allocate CPU tensors on the NUMA nodes of the compute cores. Disabled otherwise." << std::endl;
+            std::cout << "  --memory-pool-size [size] Set the memory kept for reuse by CPU tensors (MB). Default: `512`" << std::endl;
+            std::cout << "  --huge-pages [mode]     Back large CPU tensors with huge pages (`transparent` or `explicit`). Disabled otherwise." << std::endl;
             std::cout << "Other:" << std::endl;
             std::cout << "  --help, -h              Print this help message." << std::endl;
             std::cout << "  --version, -v           Print the version." << std::endl;
@@ -172,6 +318,12 @@ int main(int argc, char* argv[]) {
     Instance::Config config = {
         .preferredDevice = prefferedBackend,
         .enableCompositor = true,
+        .computeOnly = computeOnly,
+        .pipelineStages = pipelineStages,
+        .enableFusion = enableFusion,
+        .enableMemoryPlanning = enableMemoryPlanning,
+        .maximumCatchUpFrames = maximumCatchUpFrames,
+        .deadlinePolicy = deadlinePolicy,
         .backendConfig = backendConfig,
         .viewportConfig = viewportConfig,
         .renderConfig = renderConfig
@@ -189,9 +341,59 @@ int main(int argc, char* argv[]) {
 
     instance.start();
 
+    // Compute as fast as possible until interrupted.
+
+    if (computeOnly) {
+        // A second interrupt falls back to the default handler.
+        std::signal(SIGINT, [](int){
+            keepComputing = false;
+            std::signal(SIGINT, SIG_DFL);
+        });
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        auto computeThread = std::thread([&]{
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+            Backend::State<Device::CPU>()->placeComputeThread();
+#endif
+
+            while (instance.computing()) {
+                JST_CHECK_THROW(instance.compute());
+            }
+        });
+
+        // The compute thread may be waiting on a stalled source.
+        // Resetting the instance cancels that wait.
+
+        while (keepComputing && instance.computing()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+
+        const auto elapsed = std::chrono::duration<F64>(std::chrono::steady_clock::now() - startTime).count();
+        const auto frames = instance.scheduler().getComputedFrames();
+
+        JST_INFO("Computed {} frame(s) in {:.2f} s ({:.2f} frames/s).", frames, elapsed, frames / elapsed);
+
+        instance.reset();
+        instance.stop();
+
+        if (computeThread.joinable()) {
+            computeThread.join();
+        }
+
+        instance.destroy();
+        Backend::DestroyAll();
+
+        return 0;
+    }
+
     // Start compute thread.
 
     auto computeThread = std::thread([&]{
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+        Backend::State<Device::CPU>()->placeComputeThread();
+#endif
+
         while (instance.computing()) {
             JST_CHECK_THROW(instance.compute());
         }
@@ -9,20 +9,32 @@ layout(set = 0, binding = 0) uniform ShaderUniforms {
     uint height;
     float offset;
     float zoom;
+    uint format;
 } uniforms;
 
+// F32 values or packed F16 (format 1) and U8 (format 2) values.
 layout(set = 0, binding = 1) readonly buffer DataBuffer {
-    float data[];
+    uint data[];
 };
 
 layout(set = 0, binding = 2) uniform texture2D lutTex;
 layout(set = 0, binding = 3) uniform sampler lutSam;
 
+float valueAt(uint idx) {
+    if (uniforms.format == 1u) {
+        return unpackHalf2x16(data[idx >> 1u])[idx & 1u];
+    }
+    if (uniforms.format == 2u) {
+        return unpackUnorm4x8(data[idx >> 2u])[idx & 3u];
+    }
+    return uintBitsToFloat(data[idx]);
+}
+
 float samplerXY(float x, float y) {
     if (x < 0.0 || y < 0.0 || x >= uniforms.width || y >= uniforms.height) {
         return 0.0;
     }
-    return data[uint(x) + uint(y) * uniforms.width];
+    return valueAt(uint(x) + uint(y) * uniforms.width);
 }
 
 float cubicHermite(float A, float B, float C, float D, float t) {
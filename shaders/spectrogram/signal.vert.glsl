@@ -11,6 +11,7 @@ layout(set = 0, binding = 0) uniform ShaderUniforms {
     uint height;
     float offset;
     float zoom;
+    uint format;
 } uniforms;
 
 void main() {
@@ -13,23 +13,35 @@ layout(set = 0, binding = 0) uniform ShaderUniforms {
     float offset;
     float zoom;
     bool interpolate;
+    int format;
 } uniforms;
 
+// F32 values or packed F16 (format 1) and U8 (format 2) values.
 layout(set = 0, binding = 1) readonly buffer DataBuffer {
-    float data[];
+    uint data[];
 };
 
 layout(set = 0, binding = 2) uniform texture2D lutTex;
 layout(set = 0, binding = 3) uniform sampler lutSam;
 
+float valueAt(int idx) {
+    if (uniforms.format == 1) {
+        return unpackHalf2x16(data[idx >> 1])[idx & 1];
+    }
+    if (uniforms.format == 2) {
+        return unpackUnorm4x8(data[idx >> 2])[idx & 3];
+    }
+    return uintBitsToFloat(data[idx]);
+}
+
 float samplerXY(float x, float y) {
     int idx = int(y) * uniforms.width + int(x);
     if (idx < uniforms.maxSize && idx > 0) {
-        return data[idx];
+        return valueAt(idx);
     } else {
         idx += uniforms.maxSize;
         if (idx < uniforms.maxSize && idx > 0) {
-            return data[idx];
+            return valueAt(idx);
         } else {
             return 1.0;
         }
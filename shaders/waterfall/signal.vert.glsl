@@ -14,6 +14,7 @@ layout(set = 0, binding = 0) uniform ShaderUniforms {
     float offset;
     float zoom;
     bool interpolate;
+    int format;
 } uniforms;
 
 void main() {
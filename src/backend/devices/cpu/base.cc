@@ -1,10 +1,164 @@
 #include "jetstream/backend/devices/cpu/base.hh"
 
+#include <cstring>
+#include <algorithm>
+#include <filesystem>
+
 #include "jetstream/logger.hh"
+#include "jetstream/memory/devices/cpu/buffer.hh"
+#include "jetstream/memory/utils/page_pool.hh"
+
+#if !defined(JST_OS_WINDOWS) && !defined(JST_OS_BROWSER)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
 
 namespace Jetstream::Backend {
 
-CPU::CPU(const Config&) {
+// NUMA nodes of a set of cores according to sysfs.
+static U64 NodesOfCores(const std::vector<U64>& cores) {
+    U64 nodes = 0;
+
+#ifdef JST_OS_LINUX
+    for (const auto& core : cores) {
+        const auto path = jst::fmt::format("/sys/devices/system/cpu/cpu{}", core);
+
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(path, ec)) {
+            const auto name = entry.path().filename().string();
+            if (name.starts_with("node") && name.size() > 4) {
+                const U64 node = std::stoull(name.substr(4));
+                if (node < 64) {
+                    nodes |= U64(1) << node;
+                }
+            }
+        }
+    }
+#else
+    (void)cores;
+#endif
+
+    return nodes;
+}
+
+static Result PlaceThread(const Config& config, const std::vector<U64>& cores, const U64& priority) {
+#ifdef JST_OS_LINUX
+    if (!cores.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (const auto& core : cores) {
+            CPU_SET(core, &set);
+        }
+
+        if (const int err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set); err != 0) {
+            JST_WARN("[CPU] Can't pin thread to core(s) {} ({}).", cores, strerror(err));
+        } else {
+            JST_TRACE("[CPU] Pinned thread to core(s) {}.", cores);
+        }
+    }
+#else
+    if (!cores.empty()) {
+        JST_WARN("[CPU] Thread pinning isn't supported on this platform.");
+    }
+#endif
+
+    if (config.threadPolicy == ThreadPolicy::DEFAULT) {
+        return Result::SUCCESS;
+    }
+
+#if !defined(JST_OS_WINDOWS) && !defined(JST_OS_BROWSER)
+    const int policy = (config.threadPolicy == ThreadPolicy::FIFO) ? SCHED_FIFO : SCHED_RR;
+
+    sched_param param = {};
+    param.sched_priority = std::clamp<int>(static_cast<int>(priority), sched_get_priority_min(policy),
+                                                                      sched_get_priority_max(policy));
+
+    if (const int err = pthread_setschedparam(pthread_self(), policy, &param); err != 0) {
+        JST_WARN("[CPU] Can't set real-time priority {} ({}). Check the rtprio limit.", param.sched_priority,
+                                                                                         strerror(err));
+    } else {
+        JST_TRACE("[CPU] Thread running with real-time priority {}.", param.sched_priority);
+    }
+#else
+    (void)priority;
+    JST_WARN("[CPU] Real-time scheduling isn't supported on this platform.");
+#endif
+
+    return Result::SUCCESS;
+}
+
+static Result PlaceComputeThread(const Config& config, const U64& index) {
+    if (config.computeCores.empty()) {
+        return PlaceThread(config, {}, config.threadPriority);
+    }
+    const auto& core = config.computeCores[index % config.computeCores.size()];
+    return PlaceThread(config, {core}, config.threadPriority);
+}
+
+CPU::CPU(const Config& config) : config(config) {
+    // The calling thread counts as one of the compute threads.
+
+    const U64 numberOfWorkers = (config.computeThreads > 0) ? (config.computeThreads - 1) :
+                                                              Executor::DefaultNumberOfWorkers();
+    // Workers can outlive the backend. They keep their own copy of the config.
+    executor = std::make_shared<Executor>(numberOfWorkers, [config](const U64& worker){
+        PlaceComputeThread(config, worker);
+    });
+
+    JST_DEBUG("[CPU] Thread pool with {} compute thread(s).", executor->concurrency());
+
+    const U64 numberOfCores = std::thread::hardware_concurrency();
+    for (const auto& cores : {config.computeCores, config.ioCores}) {
+        for (const auto& core : cores) {
+            if (numberOfCores > 0 && core >= numberOfCores) {
+                JST_WARN("[CPU] Core #{} doesn't exist. This system has {} core(s).", core, numberOfCores);
+            }
+        }
+    }
+
+    // Keep every page resident so compute never waits for the disk.
+
+    if (config.lockMemory) {
+#if !defined(JST_OS_WINDOWS) && !defined(JST_OS_BROWSER)
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+            JST_WARN("[CPU] Can't lock memory ({}). Check the memlock limit.", strerror(errno));
+        } else {
+            JST_DEBUG("[CPU] Locked current and future memory.");
+        }
+#else
+        JST_WARN("[CPU] Memory locking isn't supported on this platform.");
+#endif
+    }
+
+    // Rebuilt blocks reuse the memory of the ones they replace.
+
+    Memory::PagePool::Global().configure({
+        .capacity = config.memoryPoolSize,
+        .transparentHugePages = config.hugePages == HugePages::TRANSPARENT,
+        .explicitHugePages = config.hugePages == HugePages::EXPLICIT,
+    });
+
+    // New CPU tensors follow the compute threads.
+
+    if (config.numaLocalMemory) {
+        const U64 nodes = NodesOfCores(config.computeCores);
+
+        if (nodes == 0) {
+            JST_WARN("[CPU] NUMA-local memory needs compute cores on a system with NUMA nodes.");
+        } else {
+            JST_DEBUG("[CPU] Placing CPU tensors on NUMA node mask {:#x}.", nodes);
+            TensorBuffer<Device::CPU>::SetPreferredNodes(nodes);
+        }
+    }
+}
+
+Result CPU::placeComputeThread(const U64& index) const {
+    return PlaceComputeThread(config, index);
+}
+
+Result CPU::placeIoThread() const {
+    return PlaceThread(config, config.ioCores, config.threadPriority + 1);
 }
 
 }  // namespace Jetstream::Backend
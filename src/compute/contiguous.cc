@@ -0,0 +1,16 @@
+#include "jetstream/compute/contiguous.hh"
+
+namespace Jetstream {
+
+Contiguous::Contiguous(const std::vector<std::function<Result()>>& copies) : copies(copies) {
+    JST_DEBUG("[CONTIGUOUS] Copying {} view(s) into contiguous tensors.", copies.size());
+}
+
+Result Contiguous::compute(const Context&) {
+    for (const auto& copy : copies) {
+        JST_CHECK(copy());
+    }
+    return Result::SUCCESS;
+}
+
+}  // namespace Jetstream
@@ -0,0 +1,314 @@
+#include "jetstream/compute/executor.hh"
+
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+#include "jetstream/memory/devices/cpu/buffer.hh"
+#endif
+
+namespace Jetstream {
+
+// Queue zero is shared by threads that don't belong to the pool.
+// Queue N + 1 belongs to worker N.
+
+static thread_local const Executor* currentExecutor = nullptr;
+static thread_local U64 currentQueue = 0;
+
+struct Executor::Batch {
+    const std::vector<Task>& tasks;
+    const Dependents* dependents;
+    std::vector<std::atomic<U64>> pendingDependencies;
+    std::atomic<U64> pendingTasks;
+    std::atomic<Result> result{Result::SUCCESS};
+    U64 activeSlot = 0;
+
+    Batch(const std::vector<Task>& tasks, const Dependents* dependents)
+         : tasks(tasks),
+           dependents(dependents),
+           pendingDependencies((dependents) ? tasks.size() : 0),
+           pendingTasks(tasks.size()) {}
+};
+
+Executor::Executor(const U64& maxWorkers, const WorkerInit& workerInit)
+     : maxWorkers(maxWorkers),
+       workerInit(workerInit) {
+    JST_DEBUG("[EXECUTOR] Creating executor with up to {} worker(s).", maxWorkers);
+
+    for (U64 i = 0; i < maxWorkers + 1; i++) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+}
+
+Executor::~Executor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        running = false;
+    }
+    cond.notify_all();
+
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+U64 Executor::DefaultNumberOfWorkers() {
+#ifdef JST_OS_BROWSER
+    return 0;
+#else
+    const U64 concurrency = std::thread::hardware_concurrency();
+    return (concurrency > 1) ? (concurrency - 1) : 0;
+#endif
+}
+
+Result Executor::run(const std::vector<Task>& tasks) {
+    if (tasks.empty()) {
+        return Result::SUCCESS;
+    }
+
+    // Run inline if there is nothing to gain from dispatching.
+
+    if (tasks.size() == 1 || maxWorkers == 0) {
+        for (const auto& task : tasks) {
+            JST_CHECK(task());
+        }
+        return Result::SUCCESS;
+    }
+
+    Batch batch(tasks, nullptr);
+    return runBatch(batch);
+}
+
+Result Executor::run(const std::vector<Task>& tasks, const Dependents& dependents) {
+    if (tasks.empty()) {
+        return Result::SUCCESS;
+    }
+
+    // Tasks are listed in a valid sequential order.
+
+    if (tasks.size() == 1 || maxWorkers == 0) {
+        for (const auto& task : tasks) {
+            JST_CHECK(task());
+        }
+        return Result::SUCCESS;
+    }
+
+    if (dependents.size() != tasks.size()) {
+        JST_ERROR("[EXECUTOR] Task graph has {} task(s) but {} dependency list(s).", tasks.size(),
+                                                                                   dependents.size());
+        return Result::ERROR;
+    }
+
+    Batch batch(tasks, &dependents);
+    for (const auto& list : dependents) {
+        for (const auto& dependent : list) {
+            batch.pendingDependencies[dependent] += 1;
+        }
+    }
+    return runBatch(batch);
+}
+
+U64 Executor::numberOfChunks(const U64& size, const U64& grain) const {
+    const U64 step = std::max<U64>(grain, 1);
+    return std::min<U64>(concurrency(), (size + step - 1) / step);
+}
+
+Result Executor::parallelFor(const U64& size, const RangeTask& task, const U64& grain) {
+    return runChunks(size, grain, [&](const U64&, const U64& begin, const U64& end) {
+        return task(begin, end);
+    });
+}
+
+Result Executor::runChunks(const U64& size, const U64& grain, const ChunkTask& task) {
+    const U64 chunks = numberOfChunks(size, grain);
+
+    if (chunks <= 1) {
+        return (size > 0) ? task(0, 0, size) : Result::SUCCESS;
+    }
+
+    std::vector<Task> tasks;
+    tasks.reserve(chunks);
+    for (U64 k = 0; k < chunks; k++) {
+        const U64 begin = (k * size) / chunks;
+        const U64 end = ((k + 1) * size) / chunks;
+        tasks.push_back([&task, k, begin, end]{ return task(k, begin, end); });
+    }
+
+    return run(tasks);
+}
+
+Result Executor::runBatch(Batch& batch) {
+    spawnWorkers(std::min<U64>(batch.tasks.size() - 1, maxWorkers));
+
+    // Tasks inherit the buffer slot of the caller.
+
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    batch.activeSlot = TensorBuffer<Device::CPU>::ActiveSlot();
+#endif
+
+    // Publish every task without dependencies. Roots are collected first
+    // because published tasks start releasing their dependents right away.
+
+    std::vector<U64> roots;
+    for (U64 i = 0; i < batch.tasks.size(); i++) {
+        if (!batch.dependents || batch.pendingDependencies[i] == 0) {
+            roots.push_back(i);
+        }
+    }
+
+    for (const auto& root : roots) {
+        push({&batch, root});
+    }
+
+    // The caller thread works too until the batch is done.
+
+    while (batch.pendingTasks > 0) {
+        Item item;
+        if (pop(item)) {
+            execute(item);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [&]{ return batch.pendingTasks == 0 || queuedItems > 0; });
+    }
+
+    return batch.result;
+}
+
+void Executor::spawnWorkers(const U64& count) {
+    if (spawnedWorkers >= count) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    while (workers.size() < count) {
+        JST_TRACE("[EXECUTOR] Spawning worker #{}.", workers.size());
+        const U64 queueId = workers.size() + 1;
+        workers.emplace_back([this, queueId]{ workerLoop(queueId); });
+    }
+    spawnedWorkers = workers.size();
+}
+
+void Executor::workerLoop(const U64& queueId) {
+    currentExecutor = this;
+    currentQueue = queueId;
+
+    if (workerInit) {
+        workerInit(queueId);
+    }
+
+    while (true) {
+        Item item;
+        if (pop(item)) {
+            execute(item);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [&]{ return !running || queuedItems > 0; });
+
+        if (!running) {
+            return;
+        }
+    }
+}
+
+void Executor::push(const Item& item) {
+    const U64 queueId = (currentExecutor == this) ? currentQueue : 0;
+
+    {
+        std::lock_guard<std::mutex> lock(queues[queueId]->mutex);
+        queues[queueId]->items.push_back(item);
+        queuedItems += 1;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+    }
+    cond.notify_one();
+}
+
+bool Executor::pop(Item& item) {
+    const U64 queueId = (currentExecutor == this) ? currentQueue : 0;
+
+    // Newest work from the own queue first. It's more likely to be in cache.
+
+    {
+        auto& queue = *queues[queueId];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.items.empty()) {
+            item = queue.items.back();
+            queue.items.pop_back();
+            queuedItems -= 1;
+            return true;
+        }
+    }
+
+    // Steal the oldest work from everyone else.
+
+    for (U64 i = 1; i < queues.size(); i++) {
+        auto& queue = *queues[(queueId + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.items.empty()) {
+            item = queue.items.front();
+            queue.items.pop_front();
+            queuedItems -= 1;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Executor::execute(const Item& item) {
+    auto& batch = *item.batch;
+
+    // Tasks of a failed batch are skipped.
+
+    if (batch.result == Result::SUCCESS) {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+        const U64 previousSlot = TensorBuffer<Device::CPU>::ActiveSlot();
+        TensorBuffer<Device::CPU>::SetActiveSlot(batch.activeSlot);
+#endif
+
+        Result result = Result::SUCCESS;
+        try {
+            result = batch.tasks[item.index]();
+        } catch (const Result& error) {
+            result = error;
+        } catch (...) {
+            JST_ERROR("[EXECUTOR] Task #{} threw an unknown exception.", item.index);
+            result = Result::ERROR;
+        }
+
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+        TensorBuffer<Device::CPU>::SetActiveSlot(previousSlot);
+#endif
+
+        if (result != Result::SUCCESS) {
+            Result expected = Result::SUCCESS;
+            batch.result.compare_exchange_strong(expected, result);
+        }
+    }
+
+    // Release tasks waiting for this one.
+
+    if (batch.dependents) {
+        for (const auto& dependent : (*batch.dependents)[item.index]) {
+            if (batch.pendingDependencies[dependent].fetch_sub(1) == 1) {
+                push({&batch, dependent});
+            }
+        }
+    }
+
+    // The batch can't be touched after the last task is accounted for.
+
+    if (batch.pendingTasks.fetch_sub(1) == 1) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+        }
+        cond.notify_all();
+    }
+}
+
+}  // namespace Jetstream
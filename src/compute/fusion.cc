@@ -0,0 +1,64 @@
+#include <algorithm>
+
+#include "jetstream/compute/fusion.hh"
+
+#ifdef JETSTREAM_GRAPH_CPU_AVAILABLE
+#include "jetstream/compute/graph/cpu.hh"
+#endif
+
+namespace Jetstream {
+
+Fusion::Fusion(const std::vector<std::shared_ptr<Compute>>& blocks, const U64& numberOfElements, const U64& lanes)
+     : blocks(blocks),
+       numberOfElements(numberOfElements),
+       lanes(std::max<U64>(lanes, 1)) {
+    JST_DEBUG("[FUSION] Fusing {} elementwise block(s) over {} element(s).", blocks.size(), numberOfElements);
+}
+
+Result Fusion::createCompute(const Context& ctx) {
+    for (const auto& block : blocks) {
+        JST_CHECK(block->createCompute(ctx));
+    }
+    return Result::SUCCESS;
+}
+
+Result Fusion::computeReady() {
+    for (const auto& block : blocks) {
+        JST_CHECK(block->computeReady());
+    }
+    return Result::SUCCESS;
+}
+
+Result Fusion::compute(const Context& ctx) {
+#ifdef JETSTREAM_GRAPH_CPU_AVAILABLE
+    const U64 numberOfTiles = (numberOfElements + TileSize - 1) / TileSize;
+
+    return ctx.cpu->parallelFor(std::min(lanes, numberOfTiles), [&](const U64& begin, const U64& end) {
+        for (U64 lane = begin; lane < end; lane++) {
+            for (U64 tile = lane; tile < numberOfTiles; tile += lanes) {
+                const U64 first = tile * TileSize;
+                const U64 last = std::min(first + TileSize, numberOfElements);
+
+                for (const auto& block : blocks) {
+                    JST_CHECK(block->computeRange(ctx, first, last));
+                }
+            }
+        }
+
+        return Result::SUCCESS;
+    });
+#else
+    (void)ctx;
+    JST_ERROR("[FUSION] Fused blocks require the CPU graph.");
+    return Result::ERROR;
+#endif
+}
+
+Result Fusion::destroyCompute(const Context& ctx) {
+    for (const auto& block : blocks) {
+        JST_CHECK(block->destroyCompute(ctx));
+    }
+    return Result::SUCCESS;
+}
+
+}  // namespace Jetstream
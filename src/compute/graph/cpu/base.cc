@@ -1,3 +1,5 @@
+#include <unordered_map>
+
 #include "jetstream/compute/graph/cpu.hh"
 
 namespace Jetstream {
@@ -16,6 +18,56 @@ Result CPU::create() {
     for (const auto& block : blocks) {
         JST_CHECK(block->createCompute(*context));
     }
+
+    // Find hazards between blocks sharing a buffer. A reader waits for the
+    // last writer. A writer waits for the last writer and every reader since.
+
+    std::vector<std::set<U64>> dependencies(blocks.size());
+    std::unordered_map<U64, U64> lastWriter;
+    std::unordered_map<U64, std::vector<U64>> lastReaders;
+
+    for (U64 i = 0; i < blocks.size(); i++) {
+        for (const auto& input : blockInputs[i]) {
+            if (lastWriter.contains(input)) {
+                dependencies[i].insert(lastWriter[input]);
+            }
+            lastReaders[input].push_back(i);
+        }
+
+        for (const auto& output : blockOutputs[i]) {
+            if (lastWriter.contains(output)) {
+                dependencies[i].insert(lastWriter[output]);
+            }
+            for (const auto& reader : lastReaders[output]) {
+                if (reader != i) {
+                    dependencies[i].insert(reader);
+                }
+            }
+            lastReaders[output].clear();
+            lastWriter[output] = i;
+        }
+    }
+
+    // Create one task per block.
+
+    blockTasks.clear();
+    blockDependents.assign(blocks.size(), {});
+
+    U64 roots = 0;
+    for (U64 i = 0; i < blocks.size(); i++) {
+        blockTasks.push_back([this, i]{
+            return blocks[i]->compute(*context);
+        });
+
+        for (const auto& dependency : dependencies[i]) {
+            blockDependents[dependency].push_back(i);
+        }
+
+        roots += dependencies[i].empty() ? 1 : 0;
+    }
+
+    JST_DEBUG("[CPU] Created task graph with {} block(s) and {} root(s).", blocks.size(), roots);
+
     return Result::SUCCESS;
 }
 
@@ -27,6 +79,11 @@ Result CPU::computeReady() {
 }
 
 Result CPU::compute() {
+    // Independent blocks run concurrently when an executor is available.
+    if (executor && blocks.size() > 1) {
+        return executor->run(blockTasks, blockDependents);
+    }
+
     for (const auto& block : blocks) { 
         JST_CHECK(block->compute(*context));
     }
@@ -38,6 +95,10 @@ Result CPU::destroy() {
         JST_CHECK(block->destroyCompute(*context));
     }
     blocks.clear();
+    blockInputs.clear();
+    blockOutputs.clear();
+    blockTasks.clear();
+    blockDependents.clear();
     return Result::SUCCESS;
 }
 
@@ -22,8 +22,28 @@ Result Graph::setExternallyWiredOutput(const U64& output) {
     return Result::SUCCESS;
 }
 
-Result Graph::setModule(const std::shared_ptr<Compute>& block) {
+Result Graph::setModule(const std::shared_ptr<Compute>& block,
+                        const std::set<U64>& inputs,
+                        const std::set<U64>& outputs) {
     blocks.push_back(block);
+    blockInputs.push_back(inputs);
+    blockOutputs.push_back(outputs);
+    return Result::SUCCESS;
+}
+
+bool Graph::isEquivalent(const Graph& other) const {
+    return device() == other.device() &&
+           blocks == other.blocks &&
+           blockInputs == other.blockInputs &&
+           blockOutputs == other.blockOutputs &&
+           wiredInputSet == other.wiredInputSet &&
+           wiredOutputSet == other.wiredOutputSet &&
+           externallyWiredInputSet == other.externallyWiredInputSet &&
+           externallyWiredOutputSet == other.externallyWiredOutputSet;
+}
+
+Result Graph::setExecutor(const std::shared_ptr<Executor>& executor) {
+    this->executor = executor;
     return Result::SUCCESS;
 }
 
@@ -0,0 +1,37 @@
+#include "jetstream/compute/readiness.hh"
+
+namespace Jetstream {
+
+U64 Readiness::getEpoch() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return epoch;
+}
+
+void Readiness::notify() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        epoch += 1;
+    }
+    cond.notify_all();
+}
+
+Result Readiness::wait(const U64& epoch) {
+    std::unique_lock<std::mutex> lock(mutex);
+    cond.wait(lock, [&]{ return cancelled || this->epoch != epoch; });
+    return (cancelled) ? Result::SKIP : Result::SUCCESS;
+}
+
+void Readiness::cancel() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        cancelled = true;
+    }
+    cond.notify_all();
+}
+
+void Readiness::resume() {
+    std::lock_guard<std::mutex> lock(mutex);
+    cancelled = false;
+}
+
+}  // namespace Jetstream
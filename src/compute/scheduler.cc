@@ -1,6 +1,7 @@
 #include <ranges>
 
 #include "jetstream/compute/scheduler.hh"
+#include "jetstream/backend/base.hh"
 
 namespace Jetstream {
 
@@ -15,11 +16,89 @@ namespace Jetstream {
 //    - Wired: When a Vector is connected within or externally the graph.
 // 8. Calculate and assign Externally Wired Vectors to Graph.
 //    - Externally Wired: When a Vector is connected with another graph.
-// 9. Assert that an In-Place Module is not sharing a branched input Vector.
+// 9. Make sure that an In-Place Module runs after the other readers of a branched input Vector.
+// 10. Group graphs by sub-graph cluster so that independent clusters can run concurrently.
+// 11. Optionally split CPU clusters into pipeline stages working on consecutive frames.
+//    - Vectors crossing stages are multi-buffered so that each stage sees its own frame.
+// 12. Inside a graph, modules without a dependency between them run concurrently.
+//    - Dependencies are derived from the buffers each module reads and writes.
+// 13. Reuse graphs whose modules and wiring didn't change since the last rebuild.
+//    - Only graphs that changed are destroyed and created again.
+// 14. Optionally fuse chains of elementwise CPU modules into a single module.
+//    - The fused module runs every module of the chain tile by tile.
+//    - Intermediates only the chain reads are backed by a ring of a few tiles.
+// 15. Optionally place CPU Vectors that only live inside a graph on a shared arena.
+//    - Vectors whose lifetimes don't overlap share memory.
+// 16. Add a copy module before modules reading a copy of an input Vector.
+//    - Views are free for every reader that doesn't need contiguous data.
+//    - CPU In-Place Modules work on a copy, so they never share a branched input Vector.
 
-// TODO: Automatically add copy module if in-place check fails.
 // TODO: Redo PHash logic with locale.
 
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+template<typename... Types>
+static Result ApplyTensorTypes(const std::any& object, const auto& func) {
+    Result result = Result::ERROR;
+
+    const bool found = ([&]{
+        if (object.type() != typeid(Tensor<Device::CPU, Types>)) {
+            return false;
+        }
+        auto tensor = std::any_cast<Tensor<Device::CPU, Types>>(object);
+        result = func(tensor);
+        return true;
+    }() || ...);
+
+    if (!found) {
+        JST_DEBUG("[SCHEDULER] Vector type is not supported.");
+    }
+
+    return result;
+}
+
+static Result ApplyTensor(const std::any& object, const auto& func) {
+    return ApplyTensorTypes<F32, F64, I8, I16, I32, I64, U8, U16, U32, U64, BOOL,
+                            CF32, CF64, CI8, CI16, CI32, CI64, CU8, CU16, CU32, CU64>(object, func);
+}
+
+static Result Multibuffer(const std::any& object, const U64& depth) {
+    return ApplyTensor(object, [&](auto& tensor) {
+        return tensor.multibuffer(depth);
+    });
+}
+
+static Result Alias(const std::any& object, void* ptr) {
+    return ApplyTensor(object, [&](auto& tensor) {
+        return (ptr) ? tensor.alias(ptr) : tensor.unalias();
+    });
+}
+
+// Records the view behind a contiguous copy and how to refresh the copy.
+static Result StageContiguous(const std::string& name,
+                              const std::any& object,
+                              Parser::RecordMap& sourceMap,
+                              std::vector<std::function<Result()>>& copies) {
+    return ApplyTensor(object, [&](auto& tensor) {
+        if (!tensor.has_source()) {
+            return Result::SUCCESS;
+        }
+
+        auto source = tensor.source();
+        JST_CHECK(Parser::Ser(sourceMap, name, source));
+
+        copies.push_back([tensor]() mutable {
+            return tensor.materialize();
+        });
+
+        return Result::SUCCESS;
+    });
+}
+#endif
+
+static Locale ContiguousLocale(const Locale& locale) {
+    return {locale.blockId, locale.moduleId + "_contiguous"};
+}
+
 Result Scheduler::addModule(const Locale& locale, 
                             const std::shared_ptr<Module>& module,
                             const Parser::RecordMap& inputMap,
@@ -79,12 +158,48 @@ Result Scheduler::addModule(const Locale& locale,
     }
     JST_DEBUG("----------------------------------------------------------------------------------------------------------------------");
 
-    JST_CHECK(lockState([&]{
-        // Destroy compute logic from modules.
-        for (const auto& graph : graphs) {
-            JST_CHECK(graph->destroy());
+    // Inputs that are contiguous copies of views are produced by a copy module.
+
+    const Locale contiguousLocale = ContiguousLocale(locale);
+    Parser::RecordMap moduleInputMap = inputMap;
+    Parser::RecordMap contiguousInputMap;
+    Parser::RecordMap contiguousOutputMap;
+    std::vector<std::function<Result()>> copies;
+
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    // Copies written by an in-place module are passed on as its output.
+    // Its readers are ordered after it and don't refresh them.
+    std::unordered_set<U64> producedHashes;
+    for (const auto& [name, state] : computeModuleStates) {
+        if (name == locale.shash() || name == contiguousLocale.shash()) {
+            continue;
+        }
+        for (const auto& [_, meta] : state.outputMap) {
+            producedHashes.insert(meta.hash);
         }
+    }
+
+    for (auto& [name, meta] : moduleInputMap) {
+        if (meta.device != Device::CPU || producedHashes.contains(meta.hash)) {
+            continue;
+        }
+
+        const U64 staged = copies.size();
+        JST_CHECK(StageContiguous(name, meta.object, contiguousInputMap, copies));
+
+        if (copies.size() > staged) {
+            meta.locale = {contiguousLocale.blockId, contiguousLocale.moduleId, name};
+            contiguousOutputMap[name] = meta;
+        }
+    }
+#endif
 
+    if (!copies.empty() && !compute) {
+        JST_ERROR("[SCHEDULER] Module '{}' needs contiguous inputs but doesn't compute.", locale);
+        return Result::ERROR;
+    }
+
+    JST_CHECK(lockState([&]{
         // Add module to present and/or compute.
         if (present) {
             presentModuleStates[locale.shash()].module = present;
@@ -92,24 +207,31 @@ Result Scheduler::addModule(const Locale& locale,
             presentModuleStates[locale.shash()].outputMap = outputMap;
         }
         if (compute) {
+            computeModuleStates[locale.shash()].locale = locale;
             computeModuleStates[locale.shash()].module = compute;
             computeModuleStates[locale.shash()].device = module->device();
-            computeModuleStates[locale.shash()].inputMap = inputMap;
+            computeModuleStates[locale.shash()].inputMap = moduleInputMap;
             computeModuleStates[locale.shash()].outputMap = outputMap;
+            compute->readiness = &readiness;
+        }
+        computeModuleStates.erase(contiguousLocale.shash());
+        if (!copies.empty()) {
+            auto& state = computeModuleStates[contiguousLocale.shash()];
+            state.locale = contiguousLocale;
+            state.module = std::make_shared<Contiguous>(copies);
+            state.device = Device::CPU;
+            state.inputMap = contiguousInputMap;
+            state.outputMap = contiguousOutputMap;
+            state.module->readiness = &readiness;
         }
 
-        // Process modules into graph.
-        JST_CHECK(removeInactive());
-        JST_CHECK(arrangeDependencyOrder());
-        JST_CHECK(checkSequenceValidity());
-        JST_CHECK(createExecutionGraphs());
-
-        // Initialize graphs.
-        for (const auto& graph : graphs) {
-            JST_CHECK(graph->create());
+        // Defer planning until the transaction is committed.
+        if (transactionDepth > 0) {
+            pendingChanges = true;
+            return Result::SUCCESS;
         }
 
-        return Result::SUCCESS;
+        return updateExecutionPlan();
     }));
 
     return Result::SUCCESS;
@@ -124,11 +246,6 @@ Result Scheduler::removeModule(const Locale& locale) {
     }
 
     JST_CHECK(lockState([&]{
-        // Destroy compute logic from modules.
-        for (const auto& graph : graphs) {
-            JST_CHECK(graph->destroy());
-        }
-
         // Remove module from present and/or compute.
         if (presentModuleStates.contains(locale.shash())) {
             presentModuleStates.erase(locale.shash());
@@ -136,20 +253,59 @@ Result Scheduler::removeModule(const Locale& locale) {
         if (computeModuleStates.contains(locale.shash())) {
             computeModuleStates.erase(locale.shash());
         }
+        computeModuleStates.erase(ContiguousLocale(locale).shash());
 
-        // Process modules into graph.
-        JST_CHECK(removeInactive());
-        JST_CHECK(arrangeDependencyOrder());
-        JST_CHECK(checkSequenceValidity());
-        JST_CHECK(createExecutionGraphs());
+        // Pending additions are planned together with the removal.
+        return updateExecutionPlan();
+    }));
 
-        // Initialize graphs.
-        for (const auto& graph : graphs) {
-            JST_CHECK(graph->create());
-        }
+    return Result::SUCCESS;
+}
+
+Result Scheduler::beginTransaction() {
+    JST_TRACE("[SCHEDULER] Beginning transaction (depth {}).", transactionDepth);
+    transactionDepth += 1;
+    return Result::SUCCESS;
+}
 
+Result Scheduler::commitTransaction() {
+    if (transactionDepth == 0) {
+        JST_ERROR("[SCHEDULER] There is no transaction to commit.");
+        return Result::ERROR;
+    }
+
+    transactionDepth -= 1;
+    JST_TRACE("[SCHEDULER] Committing transaction (depth {}).", transactionDepth);
+
+    if (transactionDepth > 0 || !pendingChanges) {
         return Result::SUCCESS;
-    }));
+    }
+
+    JST_DEBUG("[SCHEDULER] Planning modules added during the transaction.");
+    return lockState([&]{
+        return updateExecutionPlan();
+    });
+}
+
+Result Scheduler::updateExecutionPlan() {
+    pendingChanges = false;
+
+    // Clusters, CPU kernels and fused passes share the thread pool of the CPU backend.
+    if (!executor) {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+        executor = Backend::State<Device::CPU>()->getExecutor();
+#else
+        executor = std::make_shared<Executor>();
+#endif
+    }
+
+    JST_CHECK(removeInactive());
+    JST_CHECK(arrangeDependencyOrder());
+    JST_CHECK(splitPipelineStages());
+    JST_CHECK(fuseElementwiseModules());
+    JST_CHECK(checkSequenceValidity());
+    JST_CHECK(planMemory());
+    JST_CHECK(createExecutionGraphs());
 
     return Result::SUCCESS;
 }
@@ -166,6 +322,12 @@ Result Scheduler::destroy() {
             JST_CHECK(graph->destroy());
         }
 
+        // Collapse multi-buffered Vectors.
+        JST_CHECK(releasePipelines());
+
+        // Give aliased Vectors their own memory back.
+        JST_CHECK(releaseMemoryPlan());
+
         // Blanks internal memory.
         computeModuleStates.clear();
         presentModuleStates.clear();
@@ -174,6 +336,16 @@ Result Scheduler::destroy() {
         executionOrder.clear();
         deviceExecutionOrder.clear();
         graphs.clear();
+        clusterGraphs.clear();
+        clusterTasks.clear();
+        fusions.clear();
+        fusionIndex.clear();
+        throttles.clear();
+        {
+            std::lock_guard<std::mutex> guard(deadlinesMutex);
+            deadlines.clear();
+        }
+        pendingChanges = false;
 
         return Result::SUCCESS;
     }));
@@ -193,42 +365,94 @@ Result Scheduler::compute() {
         return Result::SUCCESS;
     }
 
-    // The state cannot change while we are waiting for
-    // a module to finish computing. This is a workaround
-    // blocking the state from changing while we are waiting.
-    // TODO: Replace with something else can can cancel the wait.
-    {
-        computeWait.test_and_set();
-
-        wait:
-        for (const auto& graph : graphs) {
-            const auto& res = graph->computeReady();
-            if (res == Result::TIMEOUT) {
-                // Yes, I used a goto. Sue me.
-                goto wait;
-            }
-            JST_CHECK(res);
-        }
+    // Sleep until every source has data. State changes cancel the wait.
+    computeWait.test_and_set();
 
+    // A state change might have started before the flag was set.
+    if (computeHalt.test()) {
         computeWait.clear();
         computeWait.notify_all();
+        return Result::SUCCESS;
     }
 
     Result res = Result::SUCCESS;
-    {
-        std::unique_lock<std::mutex> lock(sharedMutex);
-        computeCond.wait(lock, [&] { return !presentSync; });
-        computeSync = true;
+    while (true) {
+        const U64 epoch = readiness.getEpoch();
 
+        res = Result::SUCCESS;
         for (const auto& graph : graphs) {
-            if ((res = graph->compute()) != Result::SUCCESS) {
+            res = graph->computeReady();
+            if (res != Result::SUCCESS) {
                 break;
             }
         }
 
-        computeSync = false;
+        if (res != Result::TIMEOUT || readiness.wait(epoch) == Result::SKIP) {
+            break;
+        }
     }
-    presentCond.notify_all();
+
+    if (res != Result::SUCCESS) {
+        computeWait.clear();
+        computeWait.notify_all();
+
+        if (res == Result::TIMEOUT) {
+            return Result::SUCCESS;
+        }
+        JST_CHECK(res);
+    }
+
+    // Frames already buffered by the sources are computed back to back.
+    U64 frames = 1;
+    if (maximumCatchUpFrames > 1) {
+        U64 backlog = maximumCatchUpFrames - 1;
+        for (const auto& [_, state] : validComputeModuleStates) {
+            backlog = std::min(backlog, state.module->computeBacklog());
+        }
+        frames = backlog + 1;
+    }
+    catchUpFrames = frames;
+
+    // The wait flag stays set until the last frame, so state changes only
+    // start between frames. The lock is released after every frame to let
+    // present run.
+    for (U64 frame = 0; frame < frames && res == Result::SUCCESS; frame++) {
+        if (frame > 0 && computeHalt.test()) {
+            break;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(sharedMutex);
+            computeCond.wait(lock, [&] { return decoupledPresent || !presentSync; });
+            computeSync = true;
+
+            // Independent clusters are dispatched to the executor.
+            // This only returns after every cluster is done.
+            res = executor->run(clusterTasks);
+            updateDeadlines();
+
+            // Skipped pipeline stages don't fail the batch but still count as an underrun.
+            const Result stageResult = skippedStage.exchange(Result::SUCCESS);
+            if (res == Result::SUCCESS) {
+                res = stageResult;
+            }
+
+            // Move every pipeline one frame forward.
+            for (auto& pipeline : pipelines) {
+                pipeline.step += 1;
+            }
+
+            if (res == Result::SUCCESS) {
+                computedFrames += 1;
+            }
+
+            computeSync = false;
+        }
+        presentCond.notify_all();
+    }
+
+    computeWait.clear();
+    computeWait.notify_all();
 
     if (res == Result::SUCCESS) {
         return res;
@@ -236,6 +460,7 @@ Result Scheduler::compute() {
 
     if (res == Result::TIMEOUT ||
         res == Result::SKIP) {
+        skippedFrames += 1;
         JST_WARN("[SCHEDULER] Graph underrun. Skipping frame.");
         return Result::SUCCESS;
     }
@@ -254,6 +479,16 @@ Result Scheduler::present() {
         return Result::SUCCESS;
     }
 
+    std::lock_guard<std::mutex> guard(presentMutex);
+
+    // Decoupled modules only read snapshots published by compute.
+    if (decoupledPresent) {
+        for (const auto& [_, state] : validPresentModuleStates) {
+            JST_CHECK(state.module->present());
+        }
+        return Result::SUCCESS;
+    }
+
     {
         // Present thread has priority over compute thread.
         presentSync = true;
@@ -272,15 +507,67 @@ Result Scheduler::present() {
     return Result::SUCCESS;
 }
 
+void Scheduler::setPipelineStages(const U64& stages) {
+    JST_DEBUG("[SCHEDULER] Setting pipeline stages to {}.", stages);
+    pipelineStages = std::max<U64>(stages, 1);
+}
+
+void Scheduler::setElementwiseFusion(const bool& enable) {
+    JST_DEBUG("[SCHEDULER] {} elementwise fusion.", (enable) ? "Enabling" : "Disabling");
+    elementwiseFusion = enable;
+}
+
+void Scheduler::setMemoryPlanning(const bool& enable) {
+    JST_DEBUG("[SCHEDULER] {} memory planning.", (enable) ? "Enabling" : "Disabling");
+    memoryPlanning = enable;
+}
+
+void Scheduler::setDeadlinePolicy(const DeadlinePolicy& policy) {
+    JST_DEBUG("[SCHEDULER] Setting deadline policy of present-only modules to '{}'.", GetDeadlinePolicyName(policy));
+    deadlinePolicy = policy;
+}
+
+Result Scheduler::setDeadlinePolicy(const Locale& block, const DeadlinePolicy& policy) {
+    JST_DEBUG("[SCHEDULER] Setting deadline policy of block '{}' to '{}'.", block.block(), GetDeadlinePolicyName(policy));
+
+    return lockState([&]{
+        blockPolicies[block.blockId] = policy;
+
+        if (transactionDepth > 0) {
+            pendingChanges = true;
+            return Result::SUCCESS;
+        }
+
+        return updateExecutionPlan();
+    });
+}
+
+std::vector<Scheduler::DeadlineStatistics> Scheduler::getDeadlineStatistics() const {
+    std::lock_guard<std::mutex> guard(deadlinesMutex);
+
+    std::vector<DeadlineStatistics> statistics;
+    for (const auto& deadline : deadlines) {
+        statistics.push_back(deadline.statistics);
+    }
+    return statistics;
+}
+
+void Scheduler::setMaximumCatchUpFrames(const U64& frames) {
+    JST_DEBUG("[SCHEDULER] Catching up on up to {} buffered frame(s) per wake-up.", frames);
+    maximumCatchUpFrames = std::max<U64>(frames, 1);
+}
+
 Result Scheduler::lockState(const std::function<Result()>& func) {
     // Send halt signal.
     computeHalt.test_and_set();
     presentHalt.test_and_set();
 
-    // Wait for compute to clear.
+    // Wake compute if it's waiting for data.
+    readiness.cancel();
     computeWait.wait(true);
 
     // Acquire compute/present lock.
+    presentMutex.lock();
     sharedMutex.lock();
     presentSync = true;
     computeSync = true;
@@ -292,10 +579,12 @@ Result Scheduler::lockState(const std::function<Result()>& func) {
     computeSync = false;
     presentSync = false;
     sharedMutex.unlock();
+    presentMutex.unlock();
     computeCond.notify_all();
     presentCond.notify_all();
 
     // Unhalt present.
+    readiness.resume();
     computeHalt.clear();
     computeHalt.notify_all();
     presentHalt.clear();
@@ -360,6 +649,13 @@ Result Scheduler::removeInactive() {
         }
     }
 
+    // Compute and present only run at the same time if every module allows it.
+    decoupledPresent = std::all_of(validPresentModuleStates.begin(),
+                                   validPresentModuleStates.end(), [](const auto& entry) {
+        return entry.second.module->decoupledPresent();
+    });
+    JST_DEBUG("[SCHEDULER] Present is {} from compute.", (decoupledPresent) ? "decoupled" : "serialized");
+
     return Result::SUCCESS;
 }
 
@@ -408,6 +704,68 @@ Result Scheduler::arrangeDependencyOrder() {
     JST_TRACE("Module edges cache: {}", moduleEdgesCache);
     JST_TRACE("Module input cache: {}", moduleInputCache);
 
+    JST_DEBUG("[SCHEDULER] Ordering readers of branched Vectors before in-place modules.");
+    std::unordered_map<std::string, std::vector<std::string>> inplaceDependents;
+    {
+        const auto reachable = [&](const std::string& origin) {
+            std::unordered_set<std::string> visited;
+            std::stack<std::string> stack;
+            stack.push(origin);
+
+            while (!stack.empty()) {
+                const std::string current = stack.top();
+                stack.pop();
+
+                std::vector<std::string> next = inplaceDependents[current];
+                for (const auto& [_, outputMeta] : validComputeModuleStates[current].activeOutputs) {
+                    const auto& readers = moduleInputCache[outputMeta->locale.hash()];
+                    next.insert(next.end(), readers.begin(), readers.end());
+                }
+                for (const auto& name : next) {
+                    if (visited.insert(name).second) {
+                        stack.push(name);
+                    }
+                }
+            }
+
+            return visited;
+        };
+
+        std::vector<std::string> names;
+        for (const auto& [name, _] : validComputeModuleStates) {
+            names.push_back(name);
+        }
+        std::ranges::sort(names);
+
+        // An in-place module overwrites its input, so the other readers of that
+        // Vector have to run first. Readers depending on the module can't.
+        for (const auto& name : names) {
+            const auto& state = validComputeModuleStates[name];
+
+            std::unordered_set<U64> outputs;
+            for (const auto& [_, outputMeta] : state.activeOutputs) {
+                outputs.insert(outputMeta->hash);
+            }
+
+            for (const auto& [_, inputMeta] : state.activeInputs) {
+                if (!outputs.contains(inputMeta->hash)) {
+                    continue;
+                }
+
+                const auto descendants = reachable(name);
+                for (const auto& reader : moduleInputCache[inputMeta->locale.hash()]) {
+                    if (reader == name || descendants.contains(reader)) {
+                        continue;
+                    }
+                    JST_TRACE("Module '{}' runs before in-place module '{}'.", reader, name);
+                    inplaceDependents[reader].push_back(name);
+                    degrees[name] += 1;
+                    queue.erase(name);
+                }
+            }
+        }
+    }
+
     JST_DEBUG("[SCHEDULER] Calculating primitive execution order.");
     Device lastDevice = Device::None;
     while (!queue.empty()) {
@@ -444,6 +802,12 @@ Result Scheduler::arrangeDependencyOrder() {
                 }
             }
         }
+
+        for (const auto& dependent : inplaceDependents[nextName]) {
+            if (--degrees[dependent] == 0) {
+                queue.emplace(dependent);
+            }
+        }
     }
     JST_TRACE("Primitive execution order: {}", executionOrder);
     if (executionOrder.size() != validComputeModuleStates.size()) {
@@ -510,114 +874,994 @@ Result Scheduler::arrangeDependencyOrder() {
     return Result::SUCCESS;
 }
 
-Result Scheduler::checkSequenceValidity() {
-    JST_DEBUG("[SCHEDULER] Gathering modules with inplace operations.");
-    std::unordered_map<U64, std::vector<std::string>> inplaceVectorsMap;
-    for (const auto& name : executionOrder) {
-        auto& state = validComputeModuleStates[name];
+Result Scheduler::splitPipelineStages() {
+    if (pipelineStages <= 1) {
+        return Result::SUCCESS;
+    }
 
-        std::unordered_set<U64> inputs;
-        for (const auto& [_, inputMeta] : state.activeInputs) {
-            inputs.emplace(inputMeta->hash);
-        }
+    JST_DEBUG("[SCHEDULER] Splitting CPU clusters into up to {} pipeline stages.", pipelineStages);
 
-        std::unordered_set<U64> outputs;
-        for (const auto& [_, outputMeta] : state.activeOutputs) {
-            outputs.emplace(outputMeta->hash);
-        }
+    std::unordered_map<U64, U64> clusterGraphCount;
+    for (const auto& [_, blocksNames] : deviceExecutionOrder) {
+        clusterGraphCount[validComputeModuleStates[blocksNames.front()].clusterId]++;
+    }
 
-        std::vector<U64> inplaceVectors;
-        std::ranges::set_intersection(inputs, outputs, std::back_inserter(inplaceVectors));
+    DeviceExecutionOrder pipelinedExecutionOrder;
+    for (const auto& [device, blocksNames] : deviceExecutionOrder) {
+        const auto& clusterId = validComputeModuleStates[blocksNames.front()].clusterId;
 
-        for (const auto& inplaceVector : inplaceVectors) {
-            inplaceVectorsMap[inplaceVector].push_back(name);
+        // Only clusters made of a single CPU graph are split.
+        if (device != Device::CPU || clusterGraphCount[clusterId] > 1) {
+            pipelinedExecutionOrder.push_back({device, blocksNames});
+            continue;
         }
-    }
-    JST_TRACE("In-place module map: {}", inplaceVectorsMap)
 
-    JST_DEBUG("[SCHEDULER] Gathering positional memory layout.");
-    std::map<std::pair<U64, U64>, std::vector<std::string>> pMap;
-    for (const auto& name : executionOrder) {
-        for (const auto& [_, inputMeta] : validComputeModuleStates[name].activeInputs) {
-            pMap[{inputMeta->hash, inputMeta->locale.hash()}].push_back(name);
+        // Sources are kept apart and placed in the stage of their first consumer.
+        ExecutionOrder sources;
+        ExecutionOrder body;
+        for (const auto& name : blocksNames) {
+            if (validComputeModuleStates[name].activeInputs.empty()) {
+                sources.push_back(name);
+            } else {
+                body.push_back(name);
+            }
         }
-    }
-    JST_TRACE("In-place vector map: {}", pMap)
-
-    JST_DEBUG("[SCHEDULER] Asserting that positional memory layout meets in-place requirements.");
-    for (const auto& [hashes, blocks] : pMap) {
-        const auto& [hash, phash] = hashes;
 
-        if (blocks.size() <= 1) {
+        const U64 stageCount = std::min<U64>(pipelineStages, body.size());
+        if (stageCount <= 1) {
+            pipelinedExecutionOrder.push_back({device, blocksNames});
             continue;
         }
 
-        if (inplaceVectorsMap.count(hash) > 0) {
-            std::vector<std::string> inplaceModules;
-            std::ranges::set_intersection(blocks,
-                                          inplaceVectorsMap[hash],
-                                          std::back_inserter(inplaceModules));
-            if (inplaceModules.size() > 0) {
-                JST_WARN("[SCHEDULER] Vector is being shared by at least two modules after a branch "
-                          "and at least one of them is an in-place module.");
-                JST_WARN("    Hash: 0x{:016x} | Pos: {} | Modules: {}", hash,
-                                                                        phash - hash,
-                                                                        blocks);
-                //return Result::ERROR;
-                // TODO: Implement copy module.
+        std::vector<ExecutionOrder> stages(stageCount);
+        std::unordered_map<U64, U64> firstConsumerStage;
+        for (U64 i = 0; i < body.size(); i++) {
+            const U64 stage = (i * stageCount) / body.size();
+            stages[stage].push_back(body[i]);
+
+            for (const auto& [_, inputMeta] : validComputeModuleStates[body[i]].activeInputs) {
+                firstConsumerStage.try_emplace(inputMeta->locale.hash(), stage);
+            }
+        }
+
+        for (const auto& name : sources | std::views::reverse) {
+            U64 stage = stageCount - 1;
+            for (const auto& [_, outputMeta] : validComputeModuleStates[name].activeOutputs) {
+                if (firstConsumerStage.contains(outputMeta->locale.hash())) {
+                    stage = std::min(stage, firstConsumerStage[outputMeta->locale.hash()]);
+                }
             }
+            stages[stage].insert(stages[stage].begin(), name);
+        }
+
+        for (auto& stage : stages) {
+            pipelinedExecutionOrder.push_back({device, std::move(stage)});
         }
     }
+    deviceExecutionOrder = std::move(pipelinedExecutionOrder);
+
+    JST_DEBUG("---------------------------------------------------");
+    JST_DEBUG("Pipelined execution order:");
+    JST_DEBUG("---------------------------------------------------");
+    for (U64 i = 0; i < deviceExecutionOrder.size(); i++) {
+        const auto& [device, blocksNames] = deviceExecutionOrder[i];
+        JST_DEBUG("  [{:02}] [Device::{}]: {}", i, device, blocksNames);
+    }
+    JST_DEBUG("---------------------------------------------------");
 
     return Result::SUCCESS;
 }
 
-Result Scheduler::createExecutionGraphs() {
-    graphs.clear();
+Result Scheduler::fuseElementwiseModules() {
+    std::vector<FusionState> previousFusions = std::move(fusions);
+    fusions.clear();
+    fusionIndex.clear();
+
+    if (!elementwiseFusion) {
+        return Result::SUCCESS;
+    }
+
+    JST_DEBUG("[SCHEDULER] Fusing chains of elementwise modules.");
+
+    std::unordered_map<U64, std::vector<std::string>> consumers;
+    for (const auto& [name, state] : validComputeModuleStates) {
+        for (const auto& [_, inputMeta] : state.activeInputs) {
+            consumers[inputMeta->locale.hash()].push_back(name);
+        }
+    }
+
+    const auto numberOfElements = [&](const std::string& name) -> U64 {
+        const auto& outputMap = validComputeModuleStates[name].outputMap;
+        if (outputMap.size() != 1) {
+            return 0;
+        }
+        U64 elements = 1;
+        for (const auto& dim : outputMap.begin()->second.shape) {
+            elements *= dim;
+        }
+        return elements;
+    };
 
-    JST_DEBUG("[SCHEDULER] Instantiating compute graphs and adding wired Vectors.");
     for (const auto& [device, blocksNames] : deviceExecutionOrder) {
-        auto graph = NewGraph(device);
+        if (device != Device::CPU) {
+            continue;
+        }
 
-        for (const auto& blockName : blocksNames) {
-            auto& state = validComputeModuleStates[blockName];
+        std::unordered_map<std::string, U64> position;
+        for (U64 i = 0; i < blocksNames.size(); i++) {
+            position[blocksNames[i]] = i;
+        }
+
+        // Grow chains from the output of their last module.
+
+        std::vector<ExecutionOrder> chains;
+        std::unordered_map<U64, U64> chainTails;
+        for (const auto& name : blocksNames) {
+            const auto& state = validComputeModuleStates[name];
+            const U64 elements = numberOfElements(name);
+
+            if (!state.module->elementwise() || elements == 0) {
+                continue;
+            }
 
+            U64 chain = chains.size();
             for (const auto& [_, inputMeta] : state.activeInputs) {
-                graph->setWiredInput(inputMeta->locale.hash());
+                const auto& tail = chainTails.find(inputMeta->locale.hash());
+                if (tail != chainTails.end() && numberOfElements(chains[tail->second].back()) == elements) {
+                    chain = tail->second;
+                    chainTails.erase(tail);
+                    break;
+                }
             }
 
-            for (const auto& [_, outputMeta] : state.activeOutputs) {
-                graph->setWiredOutput(outputMeta->locale.hash());
+            if (chain == chains.size()) {
+                chains.push_back({});
             }
+            chains[chain].push_back(name);
 
-            graph->setModule(state.module);
+            for (const auto& [_, outputMeta] : state.activeOutputs) {
+                chainTails[outputMeta->locale.hash()] = chain;
+            }
         }
 
-        graphs.push_back(std::move(graph));
-    }
+        // The fused module runs in place of the last module of the chain. Nothing
+        // else can consume an intermediate before that or touch the chain Vectors.
 
-    JST_DEBUG("[SCHEDULER] Creating dependency list between graphs.");
-    std::shared_ptr<Graph> previousGraph;
-    for (auto& currentGraph : graphs) {
-        if (!previousGraph) {
-            previousGraph = currentGraph;
-            continue;
-        }
+        const auto isFusable = [&](const ExecutionOrder& chain) {
+            const std::unordered_set<std::string> members(chain.begin(), chain.end());
+            const U64 last = position[chain.back()];
 
-        std::vector<U64> commonItems;
-        std::ranges::set_intersection(previousGraph->getWiredOutputs(),
-                                      currentGraph->getWiredInputs(),
-                                      std::back_inserter(commonItems));
+            for (const auto& name : chain | std::views::take(chain.size() - 1)) {
+                for (const auto& [_, outputMeta] : validComputeModuleStates[name].activeOutputs) {
+                    for (const auto& consumer : consumers[outputMeta->locale.hash()]) {
+                        if (!members.contains(consumer) && position.contains(consumer) && position[consumer] < last) {
+                            return false;
+                        }
+                    }
+                }
+            }
 
-        for (const auto& item : commonItems) {
-            previousGraph->setExternallyWiredOutput(item);
-            currentGraph->setExternallyWiredInput(item);
-        }
-    }
+            // Vectors used by the members that were already visited.
+            std::unordered_set<U64> readBuffers;
+            std::unordered_set<U64> writtenBuffers;
+            for (U64 i = position[chain.front()]; i < last; i++) {
+                const auto& state = validComputeModuleStates[blocksNames[i]];
+
+                if (members.contains(blocksNames[i])) {
+                    for (const auto& [_, inputMeta] : state.activeInputs) {
+                        readBuffers.insert(inputMeta->hash);
+                    }
+                    for (const auto& [_, outputMeta] : state.activeOutputs) {
+                        writtenBuffers.insert(outputMeta->hash);
+                    }
+                    continue;
+                }
+
+                for (const auto& [_, inputMeta] : state.activeInputs) {
+                    if (writtenBuffers.contains(inputMeta->hash)) {
+                        return false;
+                    }
+                }
+                for (const auto& [_, outputMeta] : state.activeOutputs) {
+                    if (readBuffers.contains(outputMeta->hash) || writtenBuffers.contains(outputMeta->hash)) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        };
+
+        for (auto& chain : chains) {
+            while (chain.size() > 1 && !isFusable(chain)) {
+                chain.pop_back();
+            }
+
+            if (chain.size() < 2) {
+                continue;
+            }
+
+            std::vector<std::shared_ptr<Compute>> blocks;
+            for (const auto& name : chain) {
+                blocks.push_back(validComputeModuleStates[name].module);
+            }
+            const U64 elements = numberOfElements(chain.back());
+            const U64 lanes = executor->concurrency();
+
+            // Unchanged chains keep their fused module so that the graph can be reused.
+
+            std::shared_ptr<Fusion> module;
+            for (const auto& previous : previousFusions) {
+                if (previous.module->getBlocks() == blocks &&
+                    previous.module->getNumberOfElements() == elements &&
+                    previous.module->getLanes() == lanes) {
+                    module = previous.module;
+                    break;
+                }
+            }
+            if (!module) {
+                module = std::make_shared<Fusion>(blocks, elements, lanes);
+            }
+
+            for (const auto& name : chain) {
+                fusionIndex[name] = fusions.size();
+            }
+            fusions.push_back({chain, module});
+
+            JST_TRACE("Fused modules: {}", chain);
+        }
+    }
+
+    JST_DEBUG("[SCHEDULER] Fused {} module(s) into {} pass(es).", fusionIndex.size(), fusions.size());
 
     return Result::SUCCESS;
 }
 
+Result Scheduler::checkSequenceValidity() {
+    JST_DEBUG("[SCHEDULER] Gathering modules with inplace operations.");
+    std::unordered_map<U64, std::vector<std::string>> inplaceVectorsMap;
+    for (const auto& name : executionOrder) {
+        auto& state = validComputeModuleStates[name];
+
+        std::unordered_set<U64> inputs;
+        for (const auto& [_, inputMeta] : state.activeInputs) {
+            inputs.emplace(inputMeta->hash);
+        }
+
+        std::unordered_set<U64> outputs;
+        for (const auto& [_, outputMeta] : state.activeOutputs) {
+            outputs.emplace(outputMeta->hash);
+        }
+
+        for (const auto& input : inputs) {
+            if (outputs.contains(input)) {
+                inplaceVectorsMap[input].push_back(name);
+            }
+        }
+    }
+    JST_TRACE("In-place module map: {}", inplaceVectorsMap)
+
+    JST_DEBUG("[SCHEDULER] Gathering positional memory layout.");
+    std::map<std::pair<U64, U64>, std::vector<std::string>> pMap;
+    for (const auto& name : executionOrder) {
+        for (const auto& [_, inputMeta] : validComputeModuleStates[name].activeInputs) {
+            pMap[{inputMeta->hash, inputMeta->locale.hash()}].push_back(name);
+        }
+    }
+    JST_TRACE("In-place vector map: {}", pMap)
+
+    JST_DEBUG("[SCHEDULER] Asserting that positional memory layout meets in-place requirements.");
+    for (const auto& [hashes, blocks] : pMap) {
+        const auto& [hash, phash] = hashes;
+
+        if (blocks.size() <= 1) {
+            continue;
+        }
+
+        if (inplaceVectorsMap.count(hash) > 0) {
+            std::vector<std::string> inplaceModules;
+            std::ranges::copy_if(blocks, std::back_inserter(inplaceModules), [&](const auto& block) {
+                return std::ranges::find(inplaceVectorsMap[hash], block) != inplaceVectorsMap[hash].end();
+            });
+
+            // Fine as long as the in-place module is the last reader. CPU modules
+            // tainted as in-place read a copy and never get here.
+            if (inplaceModules.size() > 1 || (inplaceModules.size() == 1 && blocks.back() != inplaceModules.front())) {
+                JST_ERROR("[SCHEDULER] Vector is being shared by at least two modules after a branch "
+                           "and an in-place module can't run after the other readers.");
+                JST_ERROR("    Hash: 0x{:016x} | Pos: {} | Modules: {}", hash,
+                                                                         phash - hash,
+                                                                         blocks);
+                return Result::ERROR;
+            }
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+Result Scheduler::planMemory() {
+    JST_CHECK(releaseMemoryPlan());
+
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    // Vectors read by present modules or written by modules keeping
+    // state in their outputs have to persist between frames.
+
+    struct User {
+        std::string name;
+        const Parser::Record* meta;
+        bool writer;
+    };
+
+    std::unordered_map<U64, std::vector<User>> users;
+    std::unordered_set<U64> pinned;
+    for (const auto& [name, state] : computeModuleStates) {
+        for (const auto& [_, meta] : state.inputMap) {
+            users[meta.hash].push_back({name, &meta, false});
+        }
+        for (const auto& [_, meta] : state.outputMap) {
+            users[meta.hash].push_back({name, &meta, true});
+            if (!state.module->transientOutputs()) {
+                pinned.insert(meta.hash);
+            }
+        }
+    }
+    for (const auto& [_, state] : presentModuleStates) {
+        for (const auto& [_, meta] : state.inputMap) {
+            pinned.insert(meta.hash);
+        }
+        for (const auto& [_, meta] : state.outputMap) {
+            pinned.insert(meta.hash);
+        }
+    }
+
+    // An intermediate of a fused chain that nothing outside the chain reads
+    // is only needed one tile at a time. It's moved to a ring of one tile per
+    // lane mapped over its whole size, so the chain never writes it back.
+
+    std::unordered_set<U64> tiled;
+    for (const auto& [blocksNames, module] : fusions) {
+        const std::unordered_set<std::string> members(blocksNames.begin(), blocksNames.end());
+        const U64 elements = module->getNumberOfElements();
+
+        U64 ringsSize = 0;
+        U64 totalSize = 0;
+        for (const auto& name : blocksNames | std::views::take(blocksNames.size() - 1)) {
+            for (const auto& [_, outputMeta] : validComputeModuleStates[name].activeOutputs) {
+                const U64 hash = outputMeta->hash;
+
+                if (pinned.contains(hash) || tiled.contains(hash)) {
+                    continue;
+                }
+
+                U64 sizeBytes = 0;
+                const bool internal = std::ranges::all_of(users[hash], [&](const auto& user) {
+                    if (!members.contains(user.name) || user.meta->device != Device::CPU || !user.meta->contiguous) {
+                        return false;
+                    }
+
+                    return ApplyTensor(user.meta->object, [&](auto& tensor) {
+                        sizeBytes = tensor.size_bytes();
+                        return (tensor.offset() == 0 && tensor.size() == elements) ? Result::SUCCESS : Result::ERROR;
+                    }) == Result::SUCCESS;
+                });
+
+                if (!internal || sizeBytes == 0) {
+                    continue;
+                }
+
+                const U64 ringSize = Fusion::TileSize * (sizeBytes / elements) * module->getLanes();
+                const U64 copies = (sizeBytes + ringSize - 1) / ringSize;
+
+                if (ringSize % Memory::MirroredMemory::Granularity() != 0 || copies < 2) {
+                    continue;
+                }
+
+                auto ring = std::make_shared<Memory::MirroredMemory>();
+                if (ring->allocate(ringSize, copies) != Result::SUCCESS || !ring->mirrored()) {
+                    continue;
+                }
+
+                if (Alias(outputMeta->object, ring->data()) != Result::SUCCESS) {
+                    continue;
+                }
+
+                plannedTensors.push_back(outputMeta->object);
+                memoryRings.push_back(ring);
+                tiled.insert(hash);
+
+                ringsSize += ringSize;
+                totalSize += sizeBytes;
+            }
+        }
+
+        if (totalSize > 0) {
+            JST_DEBUG("[SCHEDULER] Fused pass of '{}' keeps its intermediates in {:.2f} MB of tiles "
+                      "instead of {:.2f} MB.", blocksNames.back(), ringsSize / 1e6, totalSize / 1e6);
+        }
+    }
+
+    if (!memoryPlanning) {
+        return Result::SUCCESS;
+    }
+
+    JST_DEBUG("[SCHEDULER] Planning memory of intermediate Vectors.");
+
+    struct Lifetime {
+        U64 hash;
+        U64 first;
+        U64 last;
+        U64 size;
+        U64 offset;
+        const Parser::Record* record;
+        std::vector<std::string> writers;
+    };
+
+    for (U64 i = 0; i < deviceExecutionOrder.size(); i++) {
+        const auto& [device, blocksNames] = deviceExecutionOrder[i];
+
+        if (device != Device::CPU) {
+            continue;
+        }
+
+        // Fused modules run at the position of the last module of the chain.
+
+        std::unordered_map<std::string, U64> position;
+        for (U64 j = 0; j < blocksNames.size(); j++) {
+            position[blocksNames[j]] = j;
+        }
+        for (const auto& name : blocksNames) {
+            if (fusionIndex.contains(name)) {
+                position[name] = position[fusions[fusionIndex[name]].blocksNames.back()];
+            }
+        }
+
+        // Gather Vectors that are produced and consumed only inside this graph.
+
+        std::vector<Lifetime> lifetimes;
+        std::unordered_set<U64> visited;
+        for (const auto& name : blocksNames) {
+            for (const auto& [_, outputMeta] : validComputeModuleStates[name].activeOutputs) {
+                const U64 hash = outputMeta->hash;
+
+                if (pinned.contains(hash) || tiled.contains(hash) || !visited.insert(hash).second) {
+                    continue;
+                }
+
+                Lifetime lifetime = {hash, blocksNames.size(), 0, 0, 0, outputMeta, {}};
+                U64 sizeBytes = 0;
+                const bool local = std::ranges::all_of(users[hash], [&](const auto& user) {
+                    const auto& [userName, meta, writer] = user;
+
+                    if (!position.contains(userName) || meta->device != Device::CPU || !meta->contiguous) {
+                        return false;
+                    }
+
+                    U64 userSizeBytes = 0;
+                    if (ApplyTensor(meta->object, [&](auto& tensor) {
+                        userSizeBytes = tensor.size_bytes();
+                        return (tensor.offset() == 0) ? Result::SUCCESS : Result::ERROR;
+                    }) != Result::SUCCESS || (sizeBytes != 0 && sizeBytes != userSizeBytes)) {
+                        return false;
+                    }
+                    sizeBytes = userSizeBytes;
+
+                    lifetime.first = std::min(lifetime.first, position[userName]);
+                    lifetime.last = std::max(lifetime.last, position[userName]);
+                    if (writer) {
+                        lifetime.writers.push_back(userName);
+                    }
+                    return true;
+                });
+
+                if (!local || sizeBytes == 0) {
+                    continue;
+                }
+
+                lifetime.size = JST_PAGE_ALIGNED_SIZE(sizeBytes);
+                lifetimes.push_back(lifetime);
+            }
+        }
+
+        // Place the largest Vectors first at the lowest offset that doesn't
+        // overlap a Vector alive at the same time.
+
+        std::ranges::sort(lifetimes, [](const auto& a, const auto& b) {
+            return std::tie(b.size, a.first, a.hash) < std::tie(a.size, b.first, b.hash);
+        });
+
+        U64 arenaSize = 0;
+        U64 totalSize = 0;
+        std::unordered_map<std::string, std::set<U64>> hazards;
+        for (U64 j = 0; j < lifetimes.size(); j++) {
+            auto& current = lifetimes[j];
+
+            std::vector<const Lifetime*> alive;
+            for (U64 k = 0; k < j; k++) {
+                if (lifetimes[k].first <= current.last && current.first <= lifetimes[k].last) {
+                    alive.push_back(&lifetimes[k]);
+                }
+            }
+            std::ranges::sort(alive, {}, &Lifetime::offset);
+
+            for (const auto& other : alive) {
+                if (current.offset + current.size <= other->offset) {
+                    break;
+                }
+                current.offset = std::max(current.offset, other->offset + other->size);
+            }
+
+            arenaSize = std::max(arenaSize, current.offset + current.size);
+            totalSize += current.size;
+
+            // Writers of a Vector wait for the readers of the Vectors it replaces.
+            for (U64 k = 0; k < j; k++) {
+                const auto& other = lifetimes[k];
+                if (current.offset < other.offset + other.size && other.offset < current.offset + current.size) {
+                    const auto& later = (current.first > other.last) ? current : other;
+                    const auto& earlier = (current.first > other.last) ? other : current;
+                    for (const auto& writer : later.writers) {
+                        hazards[writer].insert(earlier.hash);
+                    }
+                }
+            }
+        }
+
+        if (arenaSize >= totalSize) {
+            continue;
+        }
+
+        // Move the Vectors to the arena.
+
+        Tensor<Device::CPU, U8> arena({arenaSize});
+        U64 aliased = 0;
+        for (; aliased < lifetimes.size(); aliased++) {
+            const auto& lifetime = lifetimes[aliased];
+            if (Alias(lifetime.record->object, arena.data() + lifetime.offset) != Result::SUCCESS) {
+                break;
+            }
+        }
+
+        if (aliased != lifetimes.size()) {
+            JST_DEBUG("[SCHEDULER] Can't alias Vectors of graph #{}. Keeping them apart.", i);
+            for (U64 j = 0; j < aliased; j++) {
+                JST_CHECK(Alias(lifetimes[j].record->object, nullptr));
+            }
+            continue;
+        }
+
+        for (const auto& lifetime : lifetimes) {
+            plannedTensors.push_back(lifetime.record->object);
+        }
+        for (const auto& [writer, hashes] : hazards) {
+            memoryHazards[writer].insert(hashes.begin(), hashes.end());
+        }
+        memoryArenas.push_back(arena);
+
+        JST_DEBUG("[SCHEDULER] Graph #{} shares {:.2f} MB between {} Vector(s) instead of {:.2f} MB.", i,
+                                                                                                       arenaSize / 1e6,
+                                                                                                       lifetimes.size(),
+                                                                                                       totalSize / 1e6);
+    }
+#endif
+
+    return Result::SUCCESS;
+}
+
+Result Scheduler::releaseMemoryPlan() {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    for (const auto& tensor : plannedTensors) {
+        JST_CHECK(Alias(tensor, nullptr));
+    }
+    memoryArenas.clear();
+    memoryRings.clear();
+#endif
+    plannedTensors.clear();
+    memoryHazards.clear();
+
+    return Result::SUCCESS;
+}
+
+Result Scheduler::createExecutionGraphs() {
+    JST_CHECK(releasePipelines());
+    std::vector<std::shared_ptr<Graph>> previousGraphs = std::move(graphs);
+    graphs.clear();
+    clusterGraphs.clear();
+    clusterTasks.clear();
+
+    JST_DEBUG("[SCHEDULER] Assigning deadline policies.");
+    std::unordered_map<std::string, DeadlinePolicy> policies;
+    {
+        // Modules are present-only if every consumer is a present module
+        // or present-only itself. The execution order is walked backwards
+        // so consumers are classified first.
+
+        std::unordered_map<U64, std::vector<std::string>> consumers;
+        for (const auto& [name, state] : validComputeModuleStates) {
+            for (const auto& [_, inputMeta] : state.activeInputs) {
+                consumers[inputMeta->locale.hash()].push_back(name);
+            }
+        }
+
+        std::unordered_set<std::string> presentOnly;
+        for (auto it = executionOrder.rbegin(); it != executionOrder.rend(); it++) {
+            const auto& state = validComputeModuleStates[*it];
+
+            bool visual = validPresentModuleStates.contains(*it);
+            if (!visual && !state.activeOutputs.empty()) {
+                visual = std::ranges::all_of(state.activeOutputs, [&](const auto& output) {
+                    return std::ranges::all_of(consumers[output.second->locale.hash()], [&](const auto& consumer) {
+                        return presentOnly.contains(consumer);
+                    });
+                });
+            }
+
+            if (visual) {
+                presentOnly.insert(*it);
+            }
+
+            DeadlinePolicy policy = (visual) ? deadlinePolicy : DeadlinePolicy::CRITICAL;
+            if (blockPolicies.contains(state.locale.blockId)) {
+                policy = blockPolicies[state.locale.blockId];
+            }
+
+            // Skipping is only safe on graphs that call modules every frame.
+            policies[*it] = (state.device == Device::CPU) ? policy : DeadlinePolicy::CRITICAL;
+        }
+    }
+
+    JST_DEBUG("[SCHEDULER] Instantiating compute graphs and adding wired Vectors.");
+    std::unordered_map<U64, U64> clusterIndex;
+    std::unordered_map<U64, const Parser::Record*> outputRecords;
+    std::unordered_set<U64> sourceOutputs;
+    std::unordered_map<std::string, std::shared_ptr<Throttle>> previousThrottles = std::move(throttles);
+    std::vector<DeadlineState> clusterDeadlines;
+    throttles.clear();
+    for (const auto& [device, blocksNames] : deviceExecutionOrder) {
+        std::shared_ptr<Graph> graph = NewGraph(device);
+        const auto& clusterId = validComputeModuleStates[blocksNames.front()].clusterId;
+        std::unordered_map<U64, std::pair<std::set<U64>, std::set<U64>>> fusedBuffers;
+
+        if (!clusterIndex.contains(clusterId)) {
+            clusterIndex[clusterId] = clusterGraphs.size();
+            clusterGraphs.push_back({});
+            clusterDeadlines.push_back({});
+            clusterDeadlines.back().pressure = std::make_shared<Throttle::Pressure>();
+        }
+        auto& deadline = clusterDeadlines[clusterIndex[clusterId]];
+
+        // Reuses the throttle of the previous plan if nothing changed.
+        const auto throttleModule = [&](const std::string& name,
+                                        const std::shared_ptr<Compute>& module,
+                                        const DeadlinePolicy& policy) -> std::shared_ptr<Compute> {
+            if (policy == DeadlinePolicy::CRITICAL) {
+                return module;
+            }
+
+            auto throttle = previousThrottles[name];
+            if (!throttle || throttle->getModule() != module || throttle->getPolicy() != policy) {
+                throttle = std::make_shared<Throttle>(module, policy);
+            }
+            throttle->setPressure(deadline.pressure);
+            throttles[name] = throttle;
+            deadline.throttled = true;
+
+            return throttle;
+        };
+
+        for (const auto& blockName : blocksNames) {
+            auto& state = validComputeModuleStates[blockName];
+
+            if (state.module->computePeriod() > 0.0) {
+                deadline.sources.push_back(state.module);
+            }
+
+            std::set<U64> inputBuffers;
+            for (const auto& [_, inputMeta] : state.activeInputs) {
+                graph->setWiredInput(inputMeta->locale.hash());
+                inputBuffers.insert(inputMeta->hash);
+            }
+
+            std::set<U64> outputBuffers;
+            for (const auto& [_, outputMeta] : state.activeOutputs) {
+                graph->setWiredOutput(outputMeta->locale.hash());
+                outputBuffers.insert(outputMeta->hash);
+                outputRecords[outputMeta->locale.hash()] = outputMeta;
+
+                if (state.activeInputs.empty()) {
+                    sourceOutputs.insert(outputMeta->locale.hash());
+                }
+            }
+
+            // Writing to arena memory shared with earlier Vectors.
+            if (memoryHazards.contains(blockName)) {
+                const auto& hazards = memoryHazards[blockName];
+                outputBuffers.insert(hazards.begin(), hazards.end());
+            }
+
+            // Fused modules are added once with the Vectors of the whole chain.
+            if (fusionIndex.contains(blockName)) {
+                const auto& index = fusionIndex[blockName];
+                auto& [fusedInputs, fusedOutputs] = fusedBuffers[index];
+                fusedInputs.insert(inputBuffers.begin(), inputBuffers.end());
+                fusedOutputs.insert(outputBuffers.begin(), outputBuffers.end());
+
+                if (fusions[index].blocksNames.back() == blockName) {
+                    // A chain is only throttled if all members agree.
+                    const auto& members = fusions[index].blocksNames;
+                    const bool agree = std::ranges::all_of(members, [&](const auto& member) {
+                        return policies[member] == policies[blockName];
+                    });
+                    const auto policy = (agree) ? policies[blockName] : DeadlinePolicy::CRITICAL;
+
+                    graph->setModule(throttleModule(blockName, fusions[index].module, policy), fusedInputs,
+                                                                                              fusedOutputs);
+                }
+                continue;
+            }
+
+            graph->setModule(throttleModule(blockName, state.module, policies[blockName]), inputBuffers,
+                                                                                           outputBuffers);
+        }
+
+        graph->setExecutor(executor);
+
+        clusterGraphs[clusterIndex[clusterId]].push_back(graph);
+
+        graphs.push_back(std::move(graph));
+    }
+
+    JST_DEBUG("[SCHEDULER] Creating dependency list between graphs.");
+    for (const auto& cluster : clusterGraphs) {
+        for (U64 i = 0; i < cluster.size(); i++) {
+            for (U64 j = i + 1; j < cluster.size(); j++) {
+                std::vector<U64> commonItems;
+                std::ranges::set_intersection(cluster[i]->getWiredOutputs(),
+                                              cluster[j]->getWiredInputs(),
+                                              std::back_inserter(commonItems));
+
+                for (const auto& item : commonItems) {
+                    cluster[i]->setExternallyWiredOutput(item);
+                    cluster[j]->setExternallyWiredInput(item);
+                }
+            }
+        }
+    }
+
+    JST_DEBUG("[SCHEDULER] Reusing unchanged graphs.");
+    std::vector<bool> reused(previousGraphs.size(), false);
+    std::vector<std::shared_ptr<Graph>> createdGraphs;
+    for (auto& cluster : clusterGraphs) {
+        for (auto& graph : cluster) {
+            const auto& match = std::ranges::find_if(previousGraphs, [&](const auto& previous) {
+                return previous->isEquivalent(*graph);
+            });
+
+            if (match == previousGraphs.end()) {
+                createdGraphs.push_back(graph);
+                continue;
+            }
+
+            reused[match - previousGraphs.begin()] = true;
+            std::ranges::replace(graphs, graph, *match);
+            graph = *match;
+        }
+    }
+
+    for (U64 i = 0; i < previousGraphs.size(); i++) {
+        if (!reused[i]) {
+            JST_CHECK(previousGraphs[i]->destroy());
+        }
+    }
+
+    for (const auto& graph : createdGraphs) {
+        JST_CHECK(graph->create());
+    }
+
+    JST_DEBUG("[SCHEDULER] Reused {} graph(s) and created {} graph(s).", graphs.size() - createdGraphs.size(),
+                                                                         createdGraphs.size());
+
+    JST_DEBUG("[SCHEDULER] Creating cluster tasks.");
+    pipelines.reserve(clusterGraphs.size());
+    for (U64 i = 0; i < clusterGraphs.size(); i++) {
+        const auto& cluster = clusterGraphs[i];
+
+        // Pipelined clusters have one task per stage.
+        if (pipelineStages > 1 && cluster.size() > 1 &&
+            createPipeline(cluster, outputRecords, sourceOutputs) == Result::SUCCESS) {
+            const U64 pipelineIndex = pipelines.size() - 1;
+            for (U64 stage = 0; stage < cluster.size(); stage++) {
+                clusterDeadlines[i].tasks.push_back(clusterTasks.size());
+                clusterTasks.push_back([this, pipelineIndex, stage]{
+                    return computeStage(pipelines[pipelineIndex], stage);
+                });
+            }
+            continue;
+        }
+
+        clusterDeadlines[i].tasks.push_back(clusterTasks.size());
+        clusterTasks.push_back([this, i]{
+            for (const auto& graph : clusterGraphs[i]) {
+                JST_CHECK(graph->compute());
+            }
+            return Result::SUCCESS;
+        });
+    }
+
+    // Every task is timed to check the clusters against their deadlines.
+    taskDurations.assign(clusterTasks.size(), 0.0);
+    for (U64 t = 0; t < clusterTasks.size(); t++) {
+        clusterTasks[t] = [this, t, task = std::move(clusterTasks[t])]{
+            const auto start = std::chrono::steady_clock::now();
+            const Result result = task();
+            taskDurations[t] = std::chrono::duration<F64>(std::chrono::steady_clock::now() - start).count();
+            return result;
+        };
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(deadlinesMutex);
+        deadlines = std::move(clusterDeadlines);
+    }
+    JST_DEBUG("[SCHEDULER] Created {} independent cluster(s) and {} pipeline(s).", clusterGraphs.size(),
+                                                                                  pipelines.size());
+
+    return Result::SUCCESS;
+}
+
+Result Scheduler::createPipeline(const std::vector<std::shared_ptr<Graph>>& cluster,
+                                 const std::unordered_map<U64, const Parser::Record*>& outputRecords,
+                                 const std::unordered_set<U64>& sourceOutputs) {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    // Only CPU stages can see different copies of the same Vector.
+
+    for (const auto& graph : cluster) {
+        if (graph->device() != Device::CPU) {
+            JST_DEBUG("[SCHEDULER] Cluster has non-CPU graphs. Running it sequentially.");
+            return Result::SKIP;
+        }
+    }
+
+    // Gather Vectors crossing stages. Sources might write their output
+    // only once, so they can't be multi-buffered.
+
+    std::vector<std::any> tensors;
+    for (const auto& graph : cluster) {
+        for (const auto& hash : graph->getExternallyWiredOutputs()) {
+            if (sourceOutputs.contains(hash) || !outputRecords.contains(hash)) {
+                JST_DEBUG("[SCHEDULER] Source output crosses pipeline stages. Running cluster sequentially.");
+                return Result::SKIP;
+            }
+            tensors.push_back(outputRecords.at(hash)->object);
+        }
+    }
+
+    // One copy per stage is enough because stage N is never
+    // more than N frames behind the first stage.
+
+    const U64 depth = cluster.size();
+
+    for (U64 i = 0; i < tensors.size(); i++) {
+        if (Multibuffer(tensors[i], depth) != Result::SUCCESS) {
+            for (U64 j = 0; j < i; j++) {
+                JST_CHECK(Multibuffer(tensors[j], 1));
+            }
+            JST_DEBUG("[SCHEDULER] Can't multi-buffer Vectors. Running cluster sequentially.");
+            return Result::SKIP;
+        }
+    }
+    pipelinedTensors.insert(pipelinedTensors.end(), tensors.begin(), tensors.end());
+
+    auto& pipeline = pipelines.emplace_back();
+    pipeline.stages = cluster;
+    pipeline.validFrames.assign(depth, false);
+
+    JST_DEBUG("[SCHEDULER] Created pipeline with {} stages and {} multi-buffered Vector(s).", depth, tensors.size());
+
+    return Result::SUCCESS;
+#else
+    (void)cluster;
+    (void)outputRecords;
+    (void)sourceOutputs;
+    return Result::SKIP;
+#endif
+}
+
+Result Scheduler::releasePipelines() {
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    for (const auto& tensor : pipelinedTensors) {
+        JST_CHECK(Multibuffer(tensor, 1));
+    }
+#endif
+    pipelinedTensors.clear();
+    pipelines.clear();
+
+    return Result::SUCCESS;
+}
+
+void Scheduler::updateDeadlines() {
+    std::lock_guard<std::mutex> guard(deadlinesMutex);
+
+    for (U64 i = 0; i < deadlines.size(); i++) {
+        auto& deadline = deadlines[i];
+        auto& statistics = deadline.statistics;
+        auto& pressure = *deadline.pressure;
+
+        F64 duration = 0.0;
+        for (const auto& task : deadline.tasks) {
+            duration = std::max(duration, taskDurations[task]);
+        }
+
+        F64 budget = 0.0;
+        for (const auto& source : deadline.sources) {
+            const F64 period = source->computePeriod();
+            if (period > 0.0 && (budget == 0.0 || period < budget)) {
+                budget = period;
+            }
+        }
+
+        statistics.budget = budget;
+        statistics.lastDuration = duration;
+        statistics.frames += 1;
+        if (deadline.throttled && pressure.level > 0) {
+            statistics.degradedFrames += 1;
+        }
+
+        // Degrade right away and recover after a streak of frames on time.
+
+        if (budget > 0.0 && duration > budget) {
+            statistics.misses += 1;
+            deadline.goodFrames = 0;
+
+            if (deadline.throttled && pressure.level < Throttle::MaximumLevel) {
+                pressure.level += 1;
+                JST_DEBUG("[SCHEDULER] Cluster #{} missed its deadline ({:.2f} ms > {:.2f} ms). "
+                          "Degrading to level {}.", i, duration * 1e3, budget * 1e3, pressure.level.load());
+            }
+        } else if (pressure.level > 0 && ++deadline.goodFrames >= DeadlineRecoveryFrames) {
+            pressure.level -= 1;
+            deadline.goodFrames = 0;
+            JST_DEBUG("[SCHEDULER] Cluster #{} is back on time. Recovering to level {}.", i, pressure.level.load());
+        }
+
+        statistics.level = pressure.level;
+        pressure.frame += 1;
+    }
+}
+
+Result Scheduler::computeStage(PipelineState& pipeline, const U64& stage) {
+    // Stages start one step after each other while the pipeline fills up.
+    if (pipeline.step < stage) {
+        return Result::SUCCESS;
+    }
+
+    const U64 slot = (pipeline.step - stage) % pipeline.stages.size();
+
+    // Frames dropped by a previous stage are not processed.
+    if (stage > 0 && !pipeline.validFrames[slot]) {
+        return Result::SUCCESS;
+    }
+
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    TensorBuffer<Device::CPU>::SetActiveSlot(slot);
+#endif
+    const Result result = pipeline.stages[stage]->compute();
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    TensorBuffer<Device::CPU>::SetActiveSlot(0);
+#endif
+
+    pipeline.validFrames[slot] = (result == Result::SUCCESS);
+
+    // A skipped frame only stops this stage. The other stages work on other frames.
+    if (result == Result::SKIP || result == Result::TIMEOUT) {
+        Result expected = Result::SUCCESS;
+        skippedStage.compare_exchange_strong(expected, result);
+        return Result::SUCCESS;
+    }
+
+    return result;
+}
+
 void Scheduler::drawDebugMessage() const {
     ImGui::TableNextRow();
     ImGui::TableSetColumnIndex(0);
@@ -625,6 +1869,57 @@ void Scheduler::drawDebugMessage() const {
     ImGui::TableSetColumnIndex(1);
     ImGui::TextFormatted("{} graph(s)", graphs.size());
 
+    ImGui::TableNextRow();
+    ImGui::TableSetColumnIndex(0);
+    ImGui::TextUnformatted("Clusters:");
+    ImGui::TableSetColumnIndex(1);
+    ImGui::TextFormatted("{} cluster(s) | {} worker(s)", clusterGraphs.size(),
+                                                         (executor) ? executor->numberOfWorkers() : 0);
+
+    ImGui::TableNextRow();
+    ImGui::TableSetColumnIndex(0);
+    ImGui::TextUnformatted("Pipelines:");
+    ImGui::TableSetColumnIndex(1);
+    ImGui::TextFormatted("{} pipeline(s) | {} stage(s) max", pipelines.size(), pipelineStages);
+
+    ImGui::TableNextRow();
+    ImGui::TableSetColumnIndex(0);
+    ImGui::TextUnformatted("Fusion:");
+    ImGui::TableSetColumnIndex(1);
+    ImGui::TextFormatted("{} pass(es) | {} block(s)", fusions.size(), fusionIndex.size());
+
+    ImGui::TableNextRow();
+    ImGui::TableSetColumnIndex(0);
+    ImGui::TextUnformatted("Memory:");
+    ImGui::TableSetColumnIndex(1);
+    ImGui::TextFormatted("{} shared Vector(s)", plannedTensors.size());
+
+    {
+        std::lock_guard<std::mutex> guard(deadlinesMutex);
+
+        U64 misses = 0;
+        U64 level = 0;
+        for (const auto& deadline : deadlines) {
+            misses += deadline.statistics.misses;
+            level = std::max(level, deadline.statistics.level);
+        }
+
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted("Deadlines:");
+        ImGui::TableSetColumnIndex(1);
+        ImGui::TextFormatted("{} miss(es) | {} skipped | {} throttled | level {}", misses,
+                                                                                skippedFrames.load(),
+                                                                                throttles.size(),
+                                                                                level);
+    }
+
+    ImGui::TableNextRow();
+    ImGui::TableSetColumnIndex(0);
+    ImGui::TextUnformatted("Catch-up:");
+    ImGui::TableSetColumnIndex(1);
+    ImGui::TextFormatted("{}/{} frame(s) per wake-up", catchUpFrames.load(), maximumCatchUpFrames);
+
     ImGui::TableNextRow();
     ImGui::TableSetColumnIndex(0);
     ImGui::TextUnformatted("Stale:");
@@ -635,7 +1930,8 @@ void Scheduler::drawDebugMessage() const {
     ImGui::TableSetColumnIndex(0);
     ImGui::TextUnformatted("Present:");
     ImGui::TableSetColumnIndex(1);
-    ImGui::TextFormatted("{} block(s)", validPresentModuleStates.size());
+    ImGui::TextFormatted("{} block(s) | {}", validPresentModuleStates.size(),
+                                             (decoupledPresent) ? "Decoupled" : "Serialized");
 
     ImGui::TableNextRow();
     ImGui::TableSetColumnIndex(0);
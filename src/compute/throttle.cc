@@ -0,0 +1,44 @@
+#include "jetstream/compute/throttle.hh"
+
+namespace Jetstream {
+
+Throttle::Throttle(const std::shared_ptr<Compute>& module, const DeadlinePolicy& policy)
+     : module(module),
+       policy(policy) {
+    JST_DEBUG("[THROTTLE] Throttling module with '{}' policy.", GetDeadlinePolicyName(policy));
+}
+
+void Throttle::setPressure(const std::shared_ptr<Pressure>& pressure) {
+    this->pressure = pressure;
+}
+
+Result Throttle::createCompute(const Context& ctx) {
+    return module->createCompute(ctx);
+}
+
+Result Throttle::computeReady() {
+    return module->computeReady();
+}
+
+Result Throttle::compute(const Context& ctx) {
+    const U64 level = (pressure) ? pressure->level.load() : 0;
+
+    if (level > 0) {
+        const bool skip = (policy == DeadlinePolicy::DROP) ||
+                          (policy == DeadlinePolicy::DECIMATE &&
+                           (pressure->frame.load() % (U64(1) << level)) != 0);
+
+        if (skip) {
+            skippedFrames += 1;
+            return Result::SUCCESS;
+        }
+    }
+
+    return module->compute(ctx);
+}
+
+Result Throttle::destroyCompute(const Context& ctx) {
+    return module->destroyCompute(ctx);
+}
+
+}  // namespace Jetstream
@@ -352,7 +352,20 @@ Result Flowgraph::importFromBlob() {
     if (!YamlImpl::HasNode(root, root, "graph")) {
         return Result::SUCCESS;
     }
-    
+
+    // Blocks are scheduled together so that the execution
+    // plan is computed only once for the whole flowgraph.
+
+    JST_CHECK(_instance.scheduler().beginTransaction());
+    const Result result = importGraphFromBlob();
+    JST_CHECK(_instance.scheduler().commitTransaction());
+
+    return result;
+}
+
+Result Flowgraph::importGraphFromBlob() {
+    auto root = _yaml->data.rootref()[0];
+
     for (const auto& node : YamlImpl::GetNode(root, root, "graph")) {
         const auto nodeKey = YamlImpl::ResolveReadableKey(node);
         JST_DEBUG("[FLOWGRAPH] Processing '{}' module.", nodeKey);
@@ -17,6 +17,25 @@ Result Instance::build(const Config& config) {
         return Result::ERROR;
     }
 
+    _scheduler.setPipelineStages(config.pipelineStages);
+    _scheduler.setElementwiseFusion(config.enableFusion);
+    _scheduler.setMemoryPlanning(config.enableMemoryPlanning);
+    _scheduler.setMaximumCatchUpFrames(config.maximumCatchUpFrames);
+    _scheduler.setDeadlinePolicy(config.deadlinePolicy);
+
+#ifdef JETSTREAM_BACKEND_CPU_AVAILABLE
+    JST_CHECK(Backend::Initialize<Device::CPU>(config.backendConfig));
+#endif
+
+    // Compute-only mode doesn't render anything.
+
+    _computeOnly = config.computeOnly;
+
+    if (_computeOnly) {
+        JST_INFO("[INSTANCE] Running in compute-only mode.");
+        return Result::SUCCESS;
+    }
+
     std::vector<Device> devicePriority = {
         config.preferredDevice,
         Device::Metal,
@@ -300,6 +319,17 @@ Result Instance::renameBlock(Locale input, const std::string& id) {
 
 Result Instance::blockUpdater(Locale locale, 
                               const std::function<Result(std::shared_ptr<Flowgraph::Node>&)>& updater) {
+    // Recreated blocks are scheduled together.
+
+    JST_CHECK(_scheduler.beginTransaction());
+    const Result result = recreateBlocks(locale, updater);
+    JST_CHECK(_scheduler.commitTransaction());
+
+    return result;
+}
+
+Result Instance::recreateBlocks(Locale locale, 
+                                const std::function<Result(std::shared_ptr<Flowgraph::Node>&)>& updater) {
     // List all dependencies.
 
     std::vector<Locale> dependencyTree;
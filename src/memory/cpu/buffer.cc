@@ -1,4 +1,5 @@
 #include "jetstream/memory/devices/cpu/buffer.hh"
+#include "jetstream/memory/utils/page_pool.hh"
 
 #ifdef JETSTREAM_BACKEND_VULKAN_AVAILABLE
 #include "jetstream/memory/devices/vulkan/buffer.hh"
@@ -14,19 +15,27 @@
 #include "jetstream/memory/devices/metal/buffer.hh"
 #endif
 
-#ifdef JST_OS_WINDOWS
-#define WIN32_LEAN_AND_MEAN
-#include <windows.h>
-#undef ERROR
-#undef FATAL
-#endif
-
 namespace Jetstream {
 
 using Implementation = TensorBuffer<Device::CPU>;
 
+static thread_local U64 activeSlot = 0;
+
+static void* AllocatePages(const U64& size) {
+    return Memory::PagePool::Global().allocate(size);
+}
+
+static void* AllocatePages(const U64& size, bool& zeroed) {
+    return Memory::PagePool::Global().allocate(size, zeroed);
+}
+
+static void FreePages(void* ptr) {
+    Memory::PagePool::Global().free(ptr);
+}
+
 Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
-                             const TensorPrototypeMetadata& prototype) {
+                             const TensorPrototypeMetadata& prototype,
+                             const TensorInit& init) {
     JST_TRACE("[CPU:BUFFER] Allocating new buffer.");
 
     // Initialize storage.
@@ -39,30 +48,23 @@ Implementation::TensorBuffer(std::shared_ptr<TensorStorageMetadata>& storage,
     // Allocate memory.
 
     if (prototype.size_bytes > 0) {
-        void* memoryAddr = nullptr;
-        const auto pageSize = JST_PAGESIZE();
-        const auto alignedSizeBytes = JST_PAGE_ALIGNED_SIZE(prototype.size_bytes);
-#ifdef JST_OS_WINDOWS
-        buffer = VirtualAlloc(nullptr, alignedSizeBytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
-        if (buffer == nullptr) {
-            JST_ERROR("[CPU:BUFFER] Failed to allocate CPU memory.");
-            JST_CHECK_THROW(Result::ERROR);
-        }
-#else
-        const auto result = posix_memalign(&memoryAddr, pageSize, alignedSizeBytes);
-        if (result < 0 || (buffer = static_cast<void*>(memoryAddr)) == nullptr) {
+        bool zeroed = false;
+
+        if ((buffer = AllocatePages(prototype.size_bytes, zeroed)) == nullptr) {
             JST_ERROR("[CPU:BUFFER] Failed to allocate CPU memory.");
             JST_CHECK_THROW(Result::ERROR);
         }
-#endif
+
         // Set buffer flags.
 
         set_allocated();
         set_host_accessible();
 
-        // Null out array.
+        // Null out array. Freshly mapped pages are cleared on first touch.
 
-        memset(buffer, 0, prototype.size_bytes);
+        if (init == TensorInit::ZEROED && !zeroed) {
+            memset(buffer, 0, prototype.size_bytes);
+        }
     }
 
     // Add compatible devices.
@@ -281,13 +283,112 @@ Implementation::~TensorBuffer() {
 
     // Free memory.
 
-    if (allocated()) {
-#ifdef JST_OS_WINDOWS
-        VirtualFree(buffer, 0, MEM_RELEASE);
-#else
-        free(buffer);
-#endif
+    for (U64 i = 1; i < slots.size(); i++) {
+        FreePages(slots[i]);
+    }
+
+    if (allocated() && !aliasedMemory) {
+        FreePages(buffer);
+    }
+}
+
+Result Implementation::multibuffer(const U64& depth, const U64& size_bytes) {
+    if (depth == this->depth()) {
+        return Result::SUCCESS;
+    }
+
+    JST_TRACE("[CPU:BUFFER] Changing buffer depth from {} to {}.", this->depth(), depth);
+
+    // Release extra copies. The first one is the original buffer.
+
+    for (U64 i = 1; i < slots.size(); i++) {
+        FreePages(slots[i]);
+    }
+    slots.clear();
+
+    if (depth <= 1) {
+        return Result::SUCCESS;
+    }
+
+    // Only memory owned by this buffer can be multi-buffered.
+
+    if (!allocated() || aliasedMemory) {
+        JST_ERROR("[CPU:BUFFER] Can't multi-buffer memory not owned by this buffer.");
+        return Result::ERROR;
+    }
+
+    // Allocate extra copies seeded with the current content.
+
+    slots.push_back(buffer);
+
+    for (U64 i = 1; i < depth; i++) {
+        void* slot = AllocatePages(size_bytes);
+
+        if (slot == nullptr) {
+            JST_ERROR("[CPU:BUFFER] Failed to allocate CPU memory.");
+            JST_CHECK(multibuffer(1, size_bytes));
+            return Result::ERROR;
+        }
+
+        memcpy(slot, buffer, size_bytes);
+        slots.push_back(slot);
     }
+
+    return Result::SUCCESS;
+}
+
+Result Implementation::alias(void* ptr) {
+    JST_TRACE("[CPU:BUFFER] Aliasing buffer at {} to {}.", jst::fmt::ptr(buffer), jst::fmt::ptr(ptr));
+
+    // Only memory owned by this buffer can be replaced.
+
+    if (!aliasable()) {
+        JST_ERROR("[CPU:BUFFER] Can't alias memory not owned by this buffer.");
+        return Result::ERROR;
+    }
+
+    if (!aliasedMemory) {
+        FreePages(buffer);
+    }
+    buffer = ptr;
+    aliasedMemory = true;
+
+    return Result::SUCCESS;
+}
+
+Result Implementation::unalias(const U64& size_bytes) {
+    if (!aliasedMemory) {
+        return Result::SUCCESS;
+    }
+
+    JST_TRACE("[CPU:BUFFER] Releasing alias to {}.", jst::fmt::ptr(buffer));
+
+    // The arena is still alive here. Keep the last content.
+
+    void* memory = AllocatePages(size_bytes);
+
+    if (memory == nullptr) {
+        JST_ERROR("[CPU:BUFFER] Failed to allocate CPU memory.");
+        return Result::ERROR;
+    }
+
+    memcpy(memory, buffer, size_bytes);
+    buffer = memory;
+    aliasedMemory = false;
+
+    return Result::SUCCESS;
+}
+
+U64 Implementation::ActiveSlot() noexcept {
+    return activeSlot;
+}
+
+void Implementation::SetActiveSlot(const U64& slot) noexcept {
+    activeSlot = slot;
+}
+
+void Implementation::SetPreferredNodes(const U64& nodes) noexcept {
+    Memory::PagePool::Global().setPreferredNodes(nodes);
 }
 
 }  // namespace Jetstream
\ No newline at end of file
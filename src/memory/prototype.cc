@@ -101,9 +101,42 @@ void TensorPrototype::squeeze_dims(const U64& axis) {
     update_cache();
 }
 
-Result TensorPrototype::permutation(const std::vector<U64>&) {
-    // TODO: Implement permutation.
-    throw std::runtime_error("Not implemented");
+Result TensorPrototype::permutation(const std::vector<U64>& permutation) {
+    if (permutation.size() != prototype.shape.size()) {
+        JST_ERROR("[MEMORY] Permutation {} doesn't match tensor rank ({}).", permutation, prototype.shape.size());
+        return Result::ERROR;
+    }
+
+    std::vector<bool> used(permutation.size(), false);
+    for (const auto& axis : permutation) {
+        if (axis >= permutation.size() || used[axis]) {
+            JST_ERROR("[MEMORY] Invalid permutation: {}.", permutation);
+            return Result::ERROR;
+        }
+        used[axis] = true;
+    }
+
+    // Only the strides move. The data stays where it is.
+
+    std::vector<U64> shape(permutation.size());
+    std::vector<U64> stride(permutation.size());
+    bool identity = true;
+
+    for (U64 i = 0; i < permutation.size(); i++) {
+        shape[i] = prototype.shape[permutation[i]];
+        stride[i] = prototype.stride[permutation[i]];
+        identity &= permutation[i] == i;
+    }
+
+    JST_TRACE("[MEMORY] Permutation shape: {} -> {}.", prototype.shape, shape);
+    JST_TRACE("[MEMORY] Permutation stride: {} -> {}.", prototype.stride, stride);
+
+    prototype.shape = shape;
+    prototype.stride = stride;
+    prototype.contiguous &= identity;
+
+    update_cache();
+
     return Result::SUCCESS;
 }
 
@@ -13,7 +13,9 @@ CircularBuffer<T>::CircularBuffer()
      : transfers(0),
        throughput(0.0),
        capacity(0),
-       overflows(0) {
+       overflows(0),
+       droppedElements(0),
+       blockedTime(0.0) {
     this->reset();
 }
 
@@ -22,7 +24,9 @@ CircularBuffer<T>::CircularBuffer(const U64& capacity)
      : transfers(0),
        throughput(0.0),
        capacity(capacity),
-       overflows(0) {
+       overflows(0),
+       droppedElements(0),
+       blockedTime(0.0) {
     this->reset();
     this->buffer = std::unique_ptr<T[]>(new T[getCapacity()]);
 }
@@ -30,6 +34,7 @@ CircularBuffer<T>::CircularBuffer(const U64& capacity)
 template<class T>
 CircularBuffer<T>::~CircularBuffer() {
     semaphore.notify_all();
+    space.notify_all();
     io_mtx.lock();
     buffer.reset();
 }
@@ -81,40 +86,102 @@ Result CircularBuffer<T>::get(T* buf, const U64& size) {
         transfers += size;
     }
 
+    space.notify_all();
+
 exception:
     return res;
 }
 
 template<class T>
 Result CircularBuffer<T>::put(const T* buf, const U64& size) {
-    if (getCapacity() < size) {
-        return Result::ERROR;
-    }
+    bool crossedWatermark = false;
+    U64 currentOccupancy = 0;
 
     {
-        const std::lock_guard<std::mutex> lock(io_mtx);
+        std::unique_lock<std::mutex> lock(io_mtx);
+
+        if (getCapacity() == 0) {
+            return Result::ERROR;
+        }
+
+        // Only the newest elements of a write larger than the buffer can be kept.
+        U64 skipped = 0;
+        if (getCapacity() < size) {
+            if (policy != OverflowPolicy::DROP_OLDEST) {
+                return Result::ERROR;
+            }
+            skipped = size - getCapacity();
+        }
+
+        const T* data = buf + skipped;
+        const U64 length = size - skipped;
+
+        const auto fits = [&]{
+            return getCapacity() >= (getOccupancy() + length);
+        };
+
+        if (!fits() && policy == OverflowPolicy::BLOCK) {
+            const auto start = std::chrono::steady_clock::now();
+            space.wait_for(lock, blockTimeout, fits);
+            blockedTime += std::chrono::duration<F64>(std::chrono::steady_clock::now() - start).count();
+        }
 
-        if (getCapacity() < (getOccupancy() + size)) {
+        if (!fits() || skipped > 0) {
             overflows += 1;
-            occupancy = 0;
-            head = tail;
+
+            if (policy == OverflowPolicy::DROP_OLDEST) {
+                const U64 excess = (getOccupancy() + length > getCapacity()) ?
+                                   (getOccupancy() + length - getCapacity()) : 0;
+                head = (head + excess) % getCapacity();
+                occupancy -= excess;
+                droppedElements += excess + skipped;
+            } else {
+                droppedElements += size;
+                return Result::SUCCESS;
+            }
         }
 
-        U64 stage_a = JST_MIN(size, getCapacity() - tail);
-        std::copy_n(buf, stage_a, buffer.get() + tail);
+        U64 stage_a = JST_MIN(length, getCapacity() - tail);
+        std::copy_n(data, stage_a, buffer.get() + tail);
 
-        if (stage_a < size) {
-            std::copy_n(buf + stage_a, size - stage_a, buffer.get());
+        if (stage_a < length) {
+            std::copy_n(data + stage_a, length - stage_a, buffer.get());
+        }
+
+        tail = (tail + length) % getCapacity();
+        occupancy += length;
+
+        // Only rising edges fire the watermark.
+        if (watermark > 0) {
+            crossedWatermark = !aboveWatermark && occupancy >= watermark;
+            aboveWatermark = occupancy >= watermark;
         }
+        currentOccupancy = occupancy;
+    }
 
-        tail = (tail + size) % getCapacity();
-        occupancy += size;
+    if (crossedWatermark && watermarkCallback) {
+        watermarkCallback(currentOccupancy);
     }
 
     semaphore.notify_all();
     return Result::SUCCESS;
 }
 
+template<class T>
+void CircularBuffer<T>::setOverflowPolicy(const OverflowPolicy& policy, const std::chrono::milliseconds& timeout) {
+    const std::lock_guard<std::mutex> lock(io_mtx);
+    this->policy = policy;
+    this->blockTimeout = timeout;
+}
+
+template<class T>
+void CircularBuffer<T>::setWatermark(const U64& level, const WatermarkCallback& callback) {
+    const std::lock_guard<std::mutex> lock(io_mtx);
+    this->watermark = level;
+    this->watermarkCallback = callback;
+    this->aboveWatermark = false;
+}
+
 template<class T>
 Result CircularBuffer<T>::reset() {
     {
@@ -125,6 +192,9 @@ Result CircularBuffer<T>::reset() {
         this->transfers = 0;
         this->throughput = 0;
         this->overflows = 0;
+        this->droppedElements = 0;
+        this->blockedTime = 0.0;
+        this->aboveWatermark = false;
     }
 
     semaphore.notify_all();
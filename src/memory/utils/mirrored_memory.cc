@@ -0,0 +1,124 @@
+#include <cstdlib>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/macros.hh"
+#include "jetstream/memory/utils/mirrored_memory.hh"
+
+#ifdef JST_OS_LINUX
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+#ifdef JST_OS_WINDOWS
+#include <malloc.h>
+#endif
+
+namespace Jetstream::Memory {
+
+MirroredMemory::~MirroredMemory() {
+    release();
+}
+
+U64 MirroredMemory::Granularity() {
+    return JST_PAGESIZE();
+}
+
+Result MirroredMemory::allocate(const U64& size, const U64& copies) {
+    release();
+
+    if (size == 0) {
+        return Result::SUCCESS;
+    }
+
+    if (size % Granularity() != 0) {
+        JST_ERROR("[MIRRORED_MEMORY] Size ({} bytes) isn't a multiple of the page size.", size);
+        return Result::ERROR;
+    }
+
+    if (copies < 2) {
+        JST_ERROR("[MIRRORED_MEMORY] At least two copies are required.");
+        return Result::ERROR;
+    }
+
+#ifdef JST_OS_LINUX
+    // Reserve the address space of every copy and map the same pages into each.
+
+    const int fd = memfd_create("jetstream-mirrored-memory", MFD_CLOEXEC);
+
+    if (fd >= 0 && ftruncate(fd, size) == 0) {
+        auto* base = static_cast<U8*>(mmap(nullptr, copies * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+
+        if (base != MAP_FAILED) {
+            bool mapped = true;
+            for (U64 i = 0; i < copies && mapped; i++) {
+                auto* copy = base + i * size;
+                mapped = mmap(copy, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED;
+            }
+
+            if (mapped) {
+                close(fd);
+
+                memory = base;
+                bytes = size;
+                mappings = copies;
+                mirror = true;
+
+                JST_TRACE("[MIRRORED_MEMORY] Mapped {} bytes {} times at {}.", size, copies, jst::fmt::ptr(memory));
+                return Result::SUCCESS;
+            }
+
+            munmap(base, copies * size);
+        }
+    }
+
+    if (fd >= 0) {
+        close(fd);
+    }
+
+    JST_DEBUG("[MIRRORED_MEMORY] Can't mirror {} bytes. Using a plain allocation.", size);
+#endif
+
+    // Fall back to a single copy.
+
+#ifdef JST_OS_WINDOWS
+    memory = _aligned_malloc(size, Granularity());
+#else
+    if (posix_memalign(&memory, Granularity(), size) != 0) {
+        memory = nullptr;
+    }
+#endif
+
+    if (memory == nullptr) {
+        JST_ERROR("[MIRRORED_MEMORY] Failed to allocate {} bytes.", size);
+        return Result::ERROR;
+    }
+    bytes = size;
+    mirror = false;
+
+    return Result::SUCCESS;
+}
+
+void MirroredMemory::release() {
+    if (memory == nullptr) {
+        return;
+    }
+
+#if defined(JST_OS_LINUX)
+    if (mirror) {
+        munmap(memory, mappings * bytes);
+    } else {
+        free(memory);
+    }
+#elif defined(JST_OS_WINDOWS)
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
+
+    memory = nullptr;
+    bytes = 0;
+    mappings = 0;
+    mirror = false;
+}
+
+}  // namespace Jetstream::Memory
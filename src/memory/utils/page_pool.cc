@@ -0,0 +1,308 @@
+#include <bit>
+#include <cstdlib>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/macros.hh"
+#include "jetstream/memory/utils/page_pool.hh"
+
+#if !defined(JST_OS_WINDOWS) && !defined(JST_OS_BROWSER)
+#include <sys/mman.h>
+#endif
+
+#ifdef JST_OS_LINUX
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+#endif
+
+#ifdef JST_OS_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#undef ERROR
+#undef FATAL
+#endif
+
+namespace Jetstream::Memory {
+
+// Pages are bound before they are touched so they are faulted in on the
+// right node. A single node is preferred and several are interleaved.
+static void PlacePages(void* ptr, const U64& size, const U64& nodes) {
+#ifdef JST_OS_LINUX
+    if (nodes == 0) {
+        return;
+    }
+
+    const int mode = (std::popcount(nodes) == 1) ? MPOL_PREFERRED : MPOL_INTERLEAVE;
+    if (syscall(SYS_mbind, ptr, size, mode, &nodes, 64, MPOL_MF_MOVE) != 0) {
+        JST_TRACE("[PAGE_POOL] Can't place allocation on NUMA node mask {:#x}.", nodes);
+    }
+#else
+    (void)ptr;
+    (void)size;
+    (void)nodes;
+#endif
+}
+
+PagePool::~PagePool() {
+    trim();
+}
+
+PagePool& PagePool::Global() {
+    static auto* pool = new PagePool();
+    return *pool;
+}
+
+U64 PagePool::SizeClass(const U64& size) {
+    const U64 pageSize = JST_PAGESIZE();
+    const U64 pages = std::max<U64>((size + pageSize - 1) / pageSize, 1);
+
+    if (pages <= 8) {
+        return pages * pageSize;
+    }
+
+    // Quarters of the power of two below the page count.
+    const U64 step = U64(1) << (std::bit_width(pages - 1) - 3);
+    return JST_ROUND_UP(pages, step) * pageSize;
+}
+
+void PagePool::configure(const Config& config) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->config = config;
+    }
+    trim();
+
+    JST_DEBUG("[PAGE_POOL] Caching up to {} MB. Huge pages: {}.", config.capacity / (1024*1024),
+              (config.explicitHugePages) ? "explicit" : (config.transparentHugePages) ? "transparent" : "none");
+
+#ifndef JST_OS_LINUX
+    if (config.transparentHugePages || config.explicitHugePages) {
+        JST_WARN("[PAGE_POOL] Huge pages aren't supported on this platform.");
+    }
+#endif
+}
+
+void PagePool::setPreferredNodes(const U64& nodes) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        preferredNodes = nodes;
+    }
+    trim();
+}
+
+void* PagePool::allocate(const U64& size) {
+    bool zeroed = false;
+    return allocate(size, zeroed);
+}
+
+void* PagePool::allocate(const U64& size, bool& zeroed) {
+    zeroed = false;
+    U64 classSize = SizeClass(size);
+    U64 nodes = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if ((config.transparentHugePages || config.explicitHugePages) && classSize >= HugePageSize) {
+            classSize = JST_ROUND_UP(classSize, HugePageSize);
+        }
+
+        auto it = cache.find(classSize);
+        if (it != cache.end() && !it->second.empty()) {
+            void* ptr = it->second.back();
+            it->second.pop_back();
+            cachedBytes -= classSize;
+            hits += 1;
+            return ptr;
+        }
+
+        misses += 1;
+        nodes = preferredNodes;
+    }
+
+    // Mapping can take a while. Other threads keep using the cache meanwhile.
+
+    Backing backing = Backing::PAGES;
+    void* ptr = map(classSize, backing);
+
+    if (ptr == nullptr) {
+        return nullptr;
+    }
+
+#ifdef JST_OS_WINDOWS
+    zeroed = true;
+#else
+    zeroed = backing != Backing::PAGES;
+#endif
+
+    PlacePages(ptr, classSize, nodes);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    blocks[ptr] = {classSize, backing};
+    return ptr;
+}
+
+void PagePool::free(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    Block block;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto it = blocks.find(ptr);
+        if (it == blocks.end()) {
+            JST_ERROR("[PAGE_POOL] Allocation at {} doesn't belong to the pool.", jst::fmt::ptr(ptr));
+            return;
+        }
+        block = it->second;
+
+        if (cachedBytes + block.size <= config.capacity) {
+            cache[block.size].push_back(ptr);
+            cachedBytes += block.size;
+            return;
+        }
+
+        blocks.erase(it);
+    }
+
+    unmap(ptr, block);
+}
+
+void PagePool::trim() {
+    std::vector<std::pair<void*, Block>> released;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        for (auto& [size, ptrs] : cache) {
+            for (auto* ptr : ptrs) {
+                released.push_back({ptr, blocks.at(ptr)});
+                blocks.erase(ptr);
+            }
+        }
+        cache.clear();
+        cachedBytes = 0;
+    }
+
+    for (const auto& [ptr, block] : released) {
+        unmap(ptr, block);
+    }
+
+    if (!released.empty()) {
+        JST_TRACE("[PAGE_POOL] Released {} cached allocation(s).", released.size());
+    }
+}
+
+PagePool::Config PagePool::getConfig() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return config;
+}
+
+U64 PagePool::getCachedBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return cachedBytes;
+}
+
+U64 PagePool::getHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+U64 PagePool::getMisses() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
+
+void* PagePool::map(const U64& size, Backing& backing) {
+#ifdef JST_OS_LINUX
+    bool explicitHugePages = false;
+    bool transparentHugePages = false;
+
+    if (size >= HugePageSize) {
+        std::lock_guard<std::mutex> lock(mutex);
+        explicitHugePages = config.explicitHugePages;
+        transparentHugePages = config.transparentHugePages || config.explicitHugePages;
+    }
+
+    if (explicitHugePages) {
+        void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+        if (ptr != MAP_FAILED) {
+            backing = Backing::HUGE_PAGES;
+            return ptr;
+        }
+
+        JST_TRACE("[PAGE_POOL] No explicit huge pages left for {} bytes.", size);
+    }
+
+    if (transparentHugePages) {
+        // Over-allocate to start on a huge page boundary and unmap the rest.
+        const U64 padded = size + HugePageSize;
+        auto* base = static_cast<U8*>(mmap(nullptr, padded, PROT_READ | PROT_WRITE,
+                                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+
+        if (base != MAP_FAILED) {
+            auto* ptr = reinterpret_cast<U8*>(JST_ROUND_UP(reinterpret_cast<uintptr_t>(base), HugePageSize));
+
+            if (ptr > base) {
+                munmap(base, ptr - base);
+            }
+            if (base + padded > ptr + size) {
+                munmap(ptr + size, (base + padded) - (ptr + size));
+            }
+
+            if (madvise(ptr, size, MADV_HUGEPAGE) != 0) {
+                JST_TRACE("[PAGE_POOL] Can't advise transparent huge pages for {} bytes.", size);
+            }
+
+            backing = Backing::MAPPED;
+            return ptr;
+        }
+    }
+#endif
+
+#if !defined(JST_OS_WINDOWS) && !defined(JST_OS_BROWSER)
+    if (size >= MappedSize) {
+        void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (ptr != MAP_FAILED) {
+            backing = Backing::MAPPED;
+            return ptr;
+        }
+    }
+#endif
+
+    backing = Backing::PAGES;
+
+#ifdef JST_OS_WINDOWS
+    return VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, JST_PAGESIZE(), size) != 0) {
+        return nullptr;
+    }
+    return ptr;
+#endif
+}
+
+void PagePool::unmap(void* ptr, const Block& block) {
+#if !defined(JST_OS_WINDOWS) && !defined(JST_OS_BROWSER)
+    if (block.backing != Backing::PAGES) {
+        munmap(ptr, block.size);
+        return;
+    }
+#endif
+
+#ifdef JST_OS_WINDOWS
+    (void)block;
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    (void)block;
+    std::free(ptr);
+#endif
+}
+
+}  // namespace Jetstream::Memory
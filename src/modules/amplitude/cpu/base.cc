@@ -24,8 +24,8 @@ Result Amplitude<D, IT, OT>::createCompute(const Context&) {
 }
 
 template<>
-Result Amplitude<Device::CPU, CF32, F32>::compute(const Context&) {    
-    for (U64 i = 0; i < input.buffer.size(); i++) {
+Result Amplitude<Device::CPU, CF32, F32>::computeElementwise(const U64& begin, const U64& end) {
+    for (U64 i = begin; i < end; i++) {
         const auto& number = input.buffer[i];
         const auto& real = number.real();
         const auto& imag = number.imag();
@@ -39,8 +39,8 @@ Result Amplitude<Device::CPU, CF32, F32>::compute(const Context&) {
 }
 
 template<>
-Result Amplitude<Device::CPU, F32, F32>::compute(const Context&) {    
-    for (U64 i = 0; i < input.buffer.size(); i++) {
+Result Amplitude<Device::CPU, F32, F32>::computeElementwise(const U64& begin, const U64& end) {
+    for (U64 i = begin; i < end; i++) {
         const auto& pwr = fabs(input.buffer[i]);
         output.buffer[i] = 20.0f * Backend::ApproxLog10(pwr) + scalingCoeff;
     }
@@ -48,6 +48,15 @@ Result Amplitude<Device::CPU, F32, F32>::compute(const Context&) {
     return Result::SUCCESS;
 }
 
+template<Device D, typename IT, typename OT>
+Result Amplitude<D, IT, OT>::compute(const Context& ctx) {
+    const U64 batchSize = numberOfElements / numberOfBatches;
+
+    return ctx.cpu->parallelFor(numberOfBatches, [&](const U64& begin, const U64& end) {
+        return computeElementwise(begin * batchSize, end * batchSize);
+    });
+}
+
 JST_AMPLITUDE_CPU(JST_INSTANTIATION)
 JST_AMPLITUDE_CPU(JST_BENCHMARK)
     
@@ -14,10 +14,11 @@ Result Amplitude<D, IT, OT>::create() {
     const U64 last_axis = input.buffer.rank() - 1;
     scalingCoeff = 20.0f * log10f(1.0f / input.buffer.shape()[last_axis]);
     numberOfElements = input.buffer.size();
+    numberOfBatches = numberOfElements / input.buffer.shape()[last_axis];
 
     // Allocate output.
 
-    output.buffer = Tensor<D, OT>(input.buffer.shape());
+    output.buffer = Tensor<D, OT>(input.buffer.shape(), TensorInit::UNINITIALIZED);
 
     return Result::SUCCESS;
 }
@@ -27,4 +28,17 @@ void Amplitude<D, IT, OT>::info() const {
     JST_DEBUG("  None");
 }
 
+template<Device D, typename IT, typename OT>
+bool Amplitude<D, IT, OT>::elementwise() const {
+    return D == Device::CPU;
+}
+
+template<Device D, typename IT, typename OT>
+Result Amplitude<D, IT, OT>::computeRange(const Context&, const U64& begin, const U64& end) {
+    if constexpr (D == Device::CPU) {
+        return computeElementwise(begin, end);
+    }
+    return Result::ERROR;
+}
+
 }  // namespace Jetstream
@@ -1,5 +1,6 @@
 #include "jetstream/memory/utils/circular_buffer.hh"
 #include "jetstream/modules/audio.hh"
+#include "jetstream/backend/base.hh"
 
 #include "miniaudio.h"
 
@@ -23,6 +24,7 @@ struct Audio<D, T>::Impl {
     ma_resampler resamplerCtx;
 
     Memory::CircularBuffer<F32> buffer;  
+    std::atomic_flag callbackPlaced;
 
     static void callback(ma_device* pDevice, void* pOutput, const void* pInput, ma_uint32 frameCount);
     static std::vector<std::pair<ma_device_id, std::string>> GetAvailableDevice();
@@ -214,6 +216,7 @@ Result Audio<D, T>::create() {
     // Initialize circular buffer.
 
     pimpl->buffer.resize(input.buffer.shape()[1]*20);
+    pimpl->buffer.setOverflowPolicy(Memory::StringToOverflowPolicy(config.overflowPolicy));
 
     return Result::SUCCESS;
 }
@@ -233,12 +236,18 @@ void Audio<D, T>::info() const {
     JST_DEBUG("  Device Name:        {}", config.deviceName);
     JST_DEBUG("  Input Sample Rate:  {:.2f} kHz", config.inSampleRate / 1000);
     JST_DEBUG("  Output Sample Rate: {:.2f} kHz", config.outSampleRate / 1000);
+    JST_DEBUG("  Overflow Policy:    {}", config.overflowPolicy);
 }
 
 template<Device D, typename T>
 void Audio<D, T>::Impl::callback(ma_device* pDevice, void* pOutput, const void*, ma_uint32 frameCount) {
     auto* audio = reinterpret_cast<Audio<D, T>::Impl*>(pDevice->pUserData);
 
+    // The callback thread belongs to the audio backend.
+    if (!audio->callbackPlaced.test_and_set()) {
+        Backend::State<Device::CPU>()->placeIoThread();
+    }
+
     if (frameCount < audio->buffer.getOccupancy()) {
         audio->buffer.get(reinterpret_cast<F32*>(pOutput), frameCount);
     }
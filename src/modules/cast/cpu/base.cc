@@ -11,17 +11,43 @@ Result Cast<D, IT, OT>::createCompute(const Context&) {
 }
 
 template<Device D, typename IT, typename OT>
-Result Cast<D, IT, OT>::compute(const Context&) {
-    const IT maxValue = std::numeric_limits<OT>::max();
-    const IT minValue = std::numeric_limits<OT>::min();
-
-    for (U64 i = 0; i < input.buffer.size(); i++) {
-        IT scaledValue = input.buffer[i] * config.scaler;
-        IT clampedValue = std::clamp(scaledValue, minValue, maxValue);
-        output.buffer[i]  = static_cast<OT>(clampedValue);
+Result Cast<D, IT, OT>::computeElementwise(const U64& begin, const U64& end) {
+    if constexpr (std::is_same_v<OT, CF32>) {
+        // Interleaved integer components widen without clamping. The
+        // flat loop over both components vectorizes.
+        using T = typename NumericTypeInfo<IT>::subtype;
+
+        if (begin == end) {
+            return Result::SUCCESS;
+        }
+
+        const T* in = reinterpret_cast<const T*>(&input.buffer[begin]);
+        F32* out = reinterpret_cast<F32*>(&output.buffer[begin]);
+        const U64 size = (end - begin) * 2;
+        const F32 scaler = config.scaler;
+
+        for (U64 i = 0; i < size; i++) {
+            out[i] = static_cast<F32>(in[i]) * scaler;
+        }
+
+        return Result::SUCCESS;
+    } else {
+        const IT maxValue = std::numeric_limits<OT>::max();
+        const IT minValue = std::numeric_limits<OT>::min();
+
+        for (U64 i = begin; i < end; i++) {
+            IT scaledValue = input.buffer[i] * config.scaler;
+            IT clampedValue = std::clamp(scaledValue, minValue, maxValue);
+            output.buffer[i]  = static_cast<OT>(clampedValue);
+        }
+
+        return Result::SUCCESS;
     }
+}
 
-    return Result::SUCCESS;
+template<Device D, typename IT, typename OT>
+Result Cast<D, IT, OT>::compute(const Context&) {
+    return computeElementwise(0, input.buffer.size());
 }
 
 JST_CAST_CPU(JST_INSTANTIATION)
@@ -12,8 +12,12 @@ Result Cast<D, IT, OT>::create() {
     // Configure scaler.
 
     if (config.scaler == 0.0f) {
-        if constexpr (std::is_same<IT, F32>::value && std::is_same<IT, I32>::value) {
+        if constexpr (std::is_same<IT, F32>::value && std::is_same<OT, I16>::value) {
             config.scaler = 32768.0f;
+        } else if constexpr (std::is_same<IT, CI16>::value && std::is_same<OT, CF32>::value) {
+            config.scaler = 1.0f / 32768.0f;
+        } else if constexpr (std::is_same<IT, CI8>::value && std::is_same<OT, CF32>::value) {
+            config.scaler = 1.0f / 128.0f;
         } else {
             JST_ERROR("[CAST] No default scaler for the cast operation.");
             return Result::ERROR;
@@ -22,7 +26,7 @@ Result Cast<D, IT, OT>::create() {
 
     // Allocate output.
 
-    output.buffer = Tensor<D, OT>(input.buffer.shape());
+    output.buffer = Tensor<D, OT>(input.buffer.shape(), TensorInit::UNINITIALIZED);
 
     return Result::SUCCESS;
 }
@@ -33,4 +37,17 @@ void Cast<D, IT, OT>::info() const {
     JST_DEBUG("  Cast Operation: {} -> {}", NumericTypeInfo<IT>::name, NumericTypeInfo<OT>::name);
 }
 
+template<Device D, typename IT, typename OT>
+bool Cast<D, IT, OT>::elementwise() const {
+    return D == Device::CPU;
+}
+
+template<Device D, typename IT, typename OT>
+Result Cast<D, IT, OT>::computeRange(const Context&, const U64& begin, const U64& end) {
+    if constexpr (D == Device::CPU) {
+        return computeElementwise(begin, end);
+    }
+    return Result::ERROR;
+}
+
 }  // namespace Jetstream
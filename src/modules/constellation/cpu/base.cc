@@ -60,6 +60,9 @@ Result Constellation<D, T>::compute(const Context&) {
         }
     }
 
+    JST_CHECK(Memory::Copy(timeSnapshots.getWriteSlot(), timeSamples));
+    timeSnapshots.publish();
+
     return Result::SUCCESS;
 }
 
@@ -24,6 +24,11 @@ Result Constellation<D, T>::create() {
 
     timeSamples = Tensor<D, F32>({config.viewSize.width, config.viewSize.height});
 
+    // Compute hands snapshots of the histogram over to present.
+
+    signalSamples = Tensor<D, F32>(timeSamples.shape());
+    timeSnapshots.reset(timeSamples.shape());
+
     return Result::SUCCESS;
 }
 
@@ -82,8 +87,8 @@ Result Constellation<D, T>::createPresent() {
 
     {
         Render::Texture::Config cfg;
-        cfg.buffer = (U8*)(timeSamples.data());
-        cfg.size = {timeSamples.shape()[0], timeSamples.shape()[1]};
+        cfg.buffer = (U8*)(signalSamples.data());
+        cfg.size = {signalSamples.shape()[0], signalSamples.shape()[1]};
         cfg.dfmt = Render::Texture::DataFormat::F32;
         cfg.pfmt = Render::Texture::PixelFormat::RED;
         cfg.ptype = Render::Texture::PixelType::F32;
@@ -146,10 +151,13 @@ Result Constellation<D, T>::createPresent() {
 
 template<Device D, typename T>
 Result Constellation<D, T>::present() {
-    signalTexture->fill();
+    if (timeSnapshots.consume()) {
+        JST_CHECK(Memory::Copy(signalSamples, timeSnapshots.getReadSlot()));
+        JST_CHECK(signalTexture->fill());
+    }
 
-    gimpl->signalUniforms.width = timeSamples.shape()[0];
-    gimpl->signalUniforms.height = timeSamples.shape()[1];
+    gimpl->signalUniforms.width = signalSamples.shape()[0];
+    gimpl->signalUniforms.height = signalSamples.shape()[1];
     gimpl->signalUniforms.zoom = 1.0;
     gimpl->signalUniforms.offset = 0.0;
 
@@ -165,6 +173,11 @@ Result Constellation<D, T>::destroyPresent() {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+bool Constellation<D, T>::decoupledPresent() const {
+    return true;
+}
+
 template<Device D, typename T>
 const Size2D<U64>& Constellation<D, T>::viewSize(const Size2D<U64>& viewSize) {
     if (surface->size(viewSize) != this->viewSize()) {
@@ -14,7 +14,7 @@ Result Duplicate<D, T>::create() {
     if constexpr (D == Device::CUDA) {
         output.buffer = Tensor<D, T>(input.buffer.shape(), config.hostAccessible);
     } else {
-        output.buffer = Tensor<D, T>(input.buffer.shape());
+        output.buffer = Tensor<D, T>(input.buffer.shape(), TensorInit::UNINITIALIZED);
     }
 
     return Result::SUCCESS;
@@ -12,6 +12,9 @@ struct FFT<D, IT, OT>::Impl {
     pocketfft::stride_t i_stride;
     pocketfft::stride_t o_stride;
     pocketfft::shape_t axes;
+
+    U64 numberOfBatches;
+    U64 batchStride;
 };
 
 template<Device D, typename IT, typename OT>
@@ -36,6 +39,11 @@ Result FFT<D, IT, OT>::createCompute(const Context&) {
 
     pimpl->axes.push_back(output.buffer.rank() - 1);
 
+    // Batches along the first axis are transformed concurrently.
+
+    pimpl->numberOfBatches = (input.buffer.rank() > 1) ? input.buffer.shape()[0] : 1;
+    pimpl->batchStride = (input.buffer.rank() > 1) ? input.buffer.stride()[0] : 0;
+
     return Result::SUCCESS;
 }
 
@@ -52,31 +60,41 @@ Result FFT<D, IT, OT>::destroyCompute(const Context&) {
 }
 
 template<>
-Result FFT<Device::CPU, CF32, CF32>::compute(const Context&) {
-    pocketfft::c2c(pimpl->shape, 
-                   pimpl->i_stride, 
-                   pimpl->o_stride, 
-                   pimpl->axes, 
-                   config.forward, 
-                   input.buffer.data(), 
-                   output.buffer.data(), 
-                   1.0f);
-
-    return Result::SUCCESS;
+Result FFT<Device::CPU, CF32, CF32>::compute(const Context& ctx) {
+    return ctx.cpu->parallelFor(pimpl->numberOfBatches, [&](const U64& begin, const U64& end) {
+        auto shape = pimpl->shape;
+        shape[0] = (pimpl->numberOfBatches > 1) ? (end - begin) : shape[0];
+
+        pocketfft::c2c(shape,
+                       pimpl->i_stride,
+                       pimpl->o_stride,
+                       pimpl->axes,
+                       config.forward,
+                       input.buffer.data() + (begin * pimpl->batchStride),
+                       output.buffer.data() + (begin * pimpl->batchStride),
+                       1.0f);
+
+        return Result::SUCCESS;
+    });
 }
 
 template<>
-Result FFT<Device::CPU, F32, CF32>::compute(const Context&) {
-    pocketfft::r2c(pimpl->shape, 
-                   pimpl->i_stride, 
-                   pimpl->o_stride, 
-                   pimpl->axes, 
-                   config.forward, 
-                   input.buffer.data(), 
-                   output.buffer.data(), 
-                   1.0f);
-
-    return Result::SUCCESS;
+Result FFT<Device::CPU, F32, CF32>::compute(const Context& ctx) {
+    return ctx.cpu->parallelFor(pimpl->numberOfBatches, [&](const U64& begin, const U64& end) {
+        auto shape = pimpl->shape;
+        shape[0] = (pimpl->numberOfBatches > 1) ? (end - begin) : shape[0];
+
+        pocketfft::r2c(shape,
+                       pimpl->i_stride,
+                       pimpl->o_stride,
+                       pimpl->axes,
+                       config.forward,
+                       input.buffer.data() + (begin * pimpl->batchStride),
+                       output.buffer.data() + (begin * pimpl->batchStride),
+                       1.0f);
+
+        return Result::SUCCESS;
+    });
 }
 
 JST_FFT_CPU(JST_INSTANTIATION)
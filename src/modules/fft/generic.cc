@@ -28,9 +28,13 @@ Result FFT<D, IT, OT>::create() {
 
     // TODO: Implement axis selection for FFT.
 
-    // Allocate output.
+    // Allocate output. Real transforms only write the first half of each batch.
 
-    output.buffer = Tensor<D, OT>(input.buffer.shape());
+    if constexpr (std::is_same_v<IT, OT>) {
+        output.buffer = Tensor<D, OT>(input.buffer.shape(), TensorInit::UNINITIALIZED);
+    } else {
+        output.buffer = Tensor<D, OT>(input.buffer.shape());
+    }
 
     return Result::SUCCESS;
 }
@@ -40,4 +44,9 @@ void FFT<D, IT, OT>::info() const {
     JST_DEBUG("  Forward: {}", config.forward ? "YES" : "NO");
 }
 
+template<Device D, typename IT, typename OT>
+bool FFT<D, IT, OT>::transientOutputs() const {
+    return true;
+}
+
 }  // namespace Jetstream
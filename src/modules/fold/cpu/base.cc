@@ -1,39 +1,47 @@
 #include "../generic.cc"
 
-#include "jetstream/backend/devices/cpu/helpers.hh"
+#include "jetstream/memory/devices/cpu/view.hh"
 
 namespace Jetstream {
 
 template<Device D, typename T>
 Result Fold<D, T>::compute(const Context&) {
-    // Zero-out output buffer.
+    return Memory::CPU::DispatchRank(input.buffer.rank(), [&](auto rank) {
+        using Memory::CPU::ForEach;
 
-    for (U64 i = 0; i < output.buffer.size(); i++) {
-        output.buffer[i] = 0.0f;
-    }
+        Memory::CPU::TensorView<T, rank> out(output.buffer);
+        Memory::CPU::TensorView<const T, rank> in(input.buffer);
 
-    // Fold input buffer.
+        // Zero-out output buffer.
 
-    std::vector<U64> shape = input.buffer.shape();
-    for (U64 i = 0; i < input.buffer.size(); i++) {
-        input.buffer.offset_to_shape(i, shape);
+        ForEach([](T& o) {
+            o = 0.0f;
+        }, out);
 
-        // Add offset to axis.
-        shape[config.axis] += config.offset;
-        shape[config.axis] %= input.buffer.shape()[config.axis];
+        // Fold input buffer. The axis is walked in runs that neither wrap
+        // around the offset nor around the fold size.
 
-        // Fold.
-        shape[config.axis] %= config.size;
-        output.buffer[shape] += input.buffer[i];
-    }
+        const U64 extent = in.shape(config.axis);
+        for (U64 i = 0; i < extent;) {
+            const U64 shifted = (i + config.offset) % extent;
+            const U64 folded = shifted % config.size;
+            const U64 length = std::min({extent - i, extent - shifted, config.size - folded});
 
-    // Average output buffer.
+            ForEach([](T& o, const T& x) {
+                o += x;
+            }, out.slice(config.axis, folded, length), in.slice(config.axis, i, length));
 
-    for (U64 i = 0; i < output.buffer.size(); i++) {
-        output.buffer[i] /= decimationFactor;
-    }
+            i += length;
+        }
 
-    return Result::SUCCESS;
+        // Average output buffer.
+
+        ForEach([&](T& o) {
+            o /= decimationFactor;
+        }, out);
+
+        return Result::SUCCESS;
+    });
 }
 
 JST_FOLD_CPU(JST_INSTANTIATION)
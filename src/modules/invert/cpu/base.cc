@@ -11,11 +11,11 @@ Result Invert<D, T>::createCompute(const Context&) {
 }
 
 template<Device D, typename T>
-Result Invert<D, T>::compute(const Context&) {
+Result Invert<D, T>::computeElementwise(const U64& begin, const U64& end) {
     const auto* in = reinterpret_cast<std::pair<T, T>*>(input.buffer.data());
     auto* out = reinterpret_cast<std::pair<T, T>*>(output.buffer.data());
 
-    for (U64 i = 0; i < input.buffer.size() / 2; i++) {
+    for (U64 i = begin / 2; i < end / 2; i++) {
         const auto& [in_even, in_odd] = in[i];
         auto& [out_even, out_odd] = out[i];
 
@@ -26,6 +26,11 @@ Result Invert<D, T>::compute(const Context&) {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result Invert<D, T>::compute(const Context&) {
+    return computeElementwise(0, input.buffer.size());
+}
+
 JST_INVERT_CPU(JST_INSTANTIATION)
 JST_INVERT_CPU(JST_BENCHMARK)
     
@@ -11,7 +11,7 @@ Result Invert<D, T>::create() {
 
     // Allocate output.
 
-    output.buffer = Tensor<D, T>(input.buffer.shape());
+    output.buffer = Tensor<D, T>(input.buffer.shape(), TensorInit::UNINITIALIZED);
 
     return Result::SUCCESS;
 }
@@ -21,4 +21,17 @@ void Invert<D, T>::info() const {
     JST_DEBUG("  None");
 }
 
+template<Device D, typename T>
+bool Invert<D, T>::elementwise() const {
+    return D == Device::CPU;
+}
+
+template<Device D, typename T>
+Result Invert<D, T>::computeRange(const Context&, const U64& begin, const U64& end) {
+    if constexpr (D == Device::CPU) {
+        return computeElementwise(begin, end);
+    }
+    return Result::ERROR;
+}
+
 }  // namespace Jetstream
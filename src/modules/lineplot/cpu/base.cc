@@ -35,34 +35,46 @@ Result Lineplot<D, T>::createCompute(const Context&) {
         signalPoints[(i * 2) + 1] = 0.0f;
     }
 
+    signalSnapshots.reset(signalPoints.shape());
+
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
-Result Lineplot<D, T>::compute(const Context&) {
-    for (U64 i = 0; i < numberOfElements; i++) {
-        pimpl->sums[i] = 0.0f;
-    }
+Result Lineplot<D, T>::compute(const Context& ctx) {
+    // Every thread reduces all batches of its own range of elements.
+    // Points are written to a snapshot that is handed over to present.
 
-    for (U64 b = 0; b < numberOfBatches; b++) {
-        for (U64 i = 0; i < numberOfElements; i++) {
-            pimpl->sums[i] += input.buffer[i + b * numberOfElements];
+    auto& points = signalSnapshots.getWriteSlot();
+
+    JST_CHECK(ctx.cpu->parallelFor(numberOfElements, [&](const U64& begin, const U64& end) {
+        for (U64 i = begin; i < end; i++) {
+            pimpl->sums[i] = 0.0f;
         }
-    }
 
-    for (U64 i = 0; i < numberOfElements; i++) {
-        // Get amplitude
-        const auto& amplitude = (pimpl->sums[i] * normalizationFactor) - 1.0f;
+        for (U64 b = 0; b < numberOfBatches; b++) {
+            for (U64 i = begin; i < end; i++) {
+                pimpl->sums[i] += input.buffer[i + b * numberOfElements];
+            }
+        }
 
-        // Calculate moving average
-        auto& average = pimpl->averaging[i];
-        average -= average / config.averaging;
-        average += amplitude / config.averaging;
+        for (U64 i = begin; i < end; i++) {
+            // Get amplitude
+            const auto& amplitude = (pimpl->sums[i] * normalizationFactor) - 1.0f;
 
-        signalPoints[(i * 2) + 1] = average;
-    }
+            // Calculate moving average
+            auto& average = pimpl->averaging[i];
+            average -= average / config.averaging;
+            average += amplitude / config.averaging;
+
+            points[(i * 2) + 0] = i * 2.0f / (numberOfElements - 1) - 1.0f;
+            points[(i * 2) + 1] = average;
+        }
+
+        return Result::SUCCESS;
+    }));
 
-    updateSignalPointsFlag = true;
+    signalSnapshots.publish();
 
     return Result::SUCCESS;
 }
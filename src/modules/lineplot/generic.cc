@@ -278,8 +278,20 @@ Result Lineplot<D, T>::destroyPresent() {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+bool Lineplot<D, T>::decoupledPresent() const {
+    return D == Device::CPU;
+}
+
 template<Device D, typename T>
 Result Lineplot<D, T>::present() {
+    if constexpr (D == Device::CPU) {
+        if (signalSnapshots.consume()) {
+            JST_CHECK(Memory::Copy(signalPoints, signalSnapshots.getReadSlot()));
+            updateSignalPointsFlag = true;
+        }
+    }
+
     if (updateGridPointsFlag) {
         gridPointsBuffer->update();
         gridKernel->update();
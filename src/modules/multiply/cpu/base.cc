@@ -5,21 +5,83 @@
 namespace Jetstream {
 
 template<Device D, typename T>
-Result Multiply<D, T>::createCompute(const Context&) {
+Result Multiply<D, T>::createCompute(const Context& ctx) {
     JST_TRACE("Create Multiply compute core using CPU backend.");
+
+    cpu.a.clear();
+    cpu.b.clear();
+    cpu.c.clear();
+
+    // Slice the batch axis into one view per thread.
+
+    const U64 numberOfBatches = (c.rank() > 1) ? c.shape()[0] : 1;
+    const U64 numberOfChunks = std::min(numberOfBatches, ctx.cpu->concurrency());
+
+    if (numberOfChunks <= 1) {
+        cpu.a.push_back(a);
+        cpu.b.push_back(b);
+        cpu.c.push_back(c);
+        return Result::SUCCESS;
+    }
+
+    for (U64 i = 0; i < numberOfChunks; i++) {
+        const Token batches((i * numberOfBatches) / numberOfChunks,
+                            ((i + 1) * numberOfBatches) / numberOfChunks);
+
+        cpu.a.push_back(a);
+        cpu.b.push_back(b);
+        cpu.c.push_back(c);
+
+        JST_CHECK(cpu.a.back().slice({batches}));
+        JST_CHECK(cpu.b.back().slice({batches}));
+        JST_CHECK(cpu.c.back().slice({batches}));
+    }
+
     return Result::SUCCESS;
 }
 
 template<Device D, typename T>
-Result Multiply<D, T>::compute(const Context&) {
-    Memory::CPU::AutomaticIterator([](const auto& a, const auto& b, auto& c) {
+Result Multiply<D, T>::compute(const Context& ctx) {
+    return ctx.cpu->parallelFor(cpu.c.size(), [&](const U64& begin, const U64& end) {
+        for (U64 i = begin; i < end; i++) {
+            Memory::CPU::AutomaticIterator([](const auto& a, const auto& b, auto& c) {
+                if constexpr (std::is_same_v<T, CF32>) {
+                    c = std::complex<F32>(a.real() * b.real() - a.imag() * b.imag(),
+                                          a.real() * b.imag() + a.imag() * b.real());
+                } else {
+                    c = a * b;
+                }
+            }, cpu.a[i], cpu.b[i], cpu.c[i]);
+        }
+
+        return Result::SUCCESS;
+    });
+}
+
+template<Device D, typename T>
+Result Multiply<D, T>::computeElementwise(const U64& begin, const U64& end) {
+    // Only called when both factors can be indexed flat.
+
+    const U64 sizeA = input.factorA.size();
+    const U64 sizeB = input.factorB.size();
+
+    U64 ia = begin % sizeA;
+    U64 ib = begin % sizeB;
+
+    for (U64 i = begin; i < end; i++) {
+        const auto& fa = input.factorA[ia];
+        const auto& fb = input.factorB[ib];
+
         if constexpr (std::is_same_v<T, CF32>) {
-            c = std::complex<F32>(a.real() * b.real() - a.imag() * b.imag(),
-                                  a.real() * b.imag() + a.imag() * b.real());
+            output.product[i] = std::complex<F32>(fa.real() * fb.real() - fa.imag() * fb.imag(),
+                                                  fa.real() * fb.imag() + fa.imag() * fb.real());
         } else {
-            c = a * b;
+            output.product[i] = fa * fb;
         }
-    }, a, b, c);
+
+        ia = (ia + 1 == sizeA) ? 0 : ia + 1;
+        ib = (ib + 1 == sizeB) ? 0 : ib + 1;
+    }
 
     return Result::SUCCESS;
 }
@@ -47,7 +47,7 @@ Result Multiply<D, T>::create() {
         output_shape[max_rank - 1 - i] = std::max(index_a, index_b);
     }
 
-    output.product = Tensor<D, T>(output_shape);
+    output.product = Tensor<D, T>(output_shape, TensorInit::UNINITIALIZED);
 
     // Broadcast input.
 
@@ -58,6 +58,18 @@ Result Multiply<D, T>::create() {
     JST_CHECK(a.broadcast_to(c.shape()));
     JST_CHECK(b.broadcast_to(c.shape()));
 
+    // Factors matching the trailing axes of the output can be indexed flat.
+
+    const auto flat = [&](const Tensor<D, T>& factor) {
+        U64 axis = 0;
+        while (axis < factor.rank() && factor.shape()[axis] == 1) {
+            axis += 1;
+        }
+        const std::vector<U64> shape(factor.shape().begin() + axis, factor.shape().end());
+        return factor.contiguous() && std::equal(shape.rbegin(), shape.rend(), output_shape.rbegin());
+    };
+    elementwiseFactors = flat(input.factorA) && flat(input.factorB);
+
     return Result::SUCCESS;
 }
 
@@ -66,4 +78,22 @@ void Multiply<D, T>::info() const {
     JST_DEBUG("  None");
 }
 
+template<Device D, typename T>
+bool Multiply<D, T>::elementwise() const {
+    return D == Device::CPU && elementwiseFactors;
+}
+
+template<Device D, typename T>
+bool Multiply<D, T>::transientOutputs() const {
+    return true;
+}
+
+template<Device D, typename T>
+Result Multiply<D, T>::computeRange(const Context&, const U64& begin, const U64& end) {
+    if constexpr (D == Device::CPU) {
+        return computeElementwise(begin, end);
+    }
+    return Result::ERROR;
+}
+
 }  // namespace Jetstream
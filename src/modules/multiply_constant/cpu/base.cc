@@ -9,14 +9,19 @@ Result MultiplyConstant<D, T>::createCompute(const Context&) {
 }
 
 template<Device D, typename T>
-Result MultiplyConstant<D, T>::compute(const Context&) {
-    for (U64 i = 0; i < input.factor.size(); i++) {
+Result MultiplyConstant<D, T>::computeElementwise(const U64& begin, const U64& end) {
+    for (U64 i = begin; i < end; i++) {
         output.product[i] = input.factor[i] * config.constant;
     }
 
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result MultiplyConstant<D, T>::compute(const Context&) {
+    return computeElementwise(0, input.factor.size());
+}
+
 JST_MULTIPLY_CONSTANT_CPU(JST_INSTANTIATION)
 JST_MULTIPLY_CONSTANT_CPU(JST_BENCHMARK)
 
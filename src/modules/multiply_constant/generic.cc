@@ -26,4 +26,17 @@ void MultiplyConstant<D, T>::info() const {
     }
 }
 
+template<Device D, typename T>
+bool MultiplyConstant<D, T>::elementwise() const {
+    return D == Device::CPU;
+}
+
+template<Device D, typename T>
+Result MultiplyConstant<D, T>::computeRange(const Context&, const U64& begin, const U64& end) {
+    if constexpr (D == Device::CPU) {
+        return computeElementwise(begin, end);
+    }
+    return Result::ERROR;
+}
+
 }  // namespace Jetstream
@@ -1,5 +1,7 @@
 #include "../generic.cc"
 
+#include "jetstream/memory/devices/cpu/view.hh"
+
 namespace Jetstream {
 
 template<Device D, typename T>
@@ -11,41 +13,47 @@ Result OverlapAdd<D, T>::createCompute(const Context&) {
 
 template<Device D, typename T>
 Result OverlapAdd<D, T>::compute(const Context&) {
-    // Copy input buffer to output buffer.
-
-    for (U64 i = 0; i < input.buffer.size(); i++) {
-        output.buffer[i] = input.buffer[i];
-    }
-
-    // Add overlap to output buffer.
-
-    {
-        std::vector<U64> shape = input.overlap.shape();
-        for (U64 i = 0; i < input.overlap.size(); i++) {
-            input.overlap.offset_to_shape(i, shape);
-            auto& sample = output.buffer[shape];
-
-            if (shape[0] == 0) {
-                sample += previousOverlap[shape];
-            } else {
-                shape[0] -= 1;
-                sample += input.overlap[shape];
-            }
+    return Memory::CPU::DispatchRank(input.buffer.rank(), [&](auto rank) {
+        using Memory::CPU::ForEach;
+
+        const auto copy = [](T& o, const T& x) {
+            o = x;
+        };
+        const auto add = [](T& o, const T& x) {
+            o += x;
+        };
+
+        Memory::CPU::TensorView<const T, rank> buffer(input.buffer);
+        Memory::CPU::TensorView<const T, rank> overlap(input.overlap);
+        Memory::CPU::TensorView<T, rank> out(output.buffer);
+        Memory::CPU::TensorView<T, rank> previous(previousOverlap);
+
+        // Copy input buffer to output buffer.
+
+        ForEach(copy, out, buffer);
+
+        // Add overlap to output buffer. The first batch element takes the
+        // overlap left by the previous call and the others the one before.
+
+        auto region = out;
+        for (U64 i = 0; i < rank; i++) {
+            region = region.slice(i, 0, overlap.shape(i));
         }
-    }
-    
-    // Get last batch element from overlap.
-
-    {
-        std::vector<U64> shape = previousOverlap.shape();
-        for (U64 i = 0; i < previousOverlap.size(); i++) {
-            previousOverlap.offset_to_shape(i, shape);
-            shape[0] = input.overlap.shape()[0] - 1;
-            previousOverlap[i] = input.overlap[shape];
+
+        const U64 batches = overlap.shape(0);
+
+        ForEach(add, region.slice(0, 0, 1), previous.slice(0, 0, 1));
+
+        if (batches > 1) {
+            ForEach(add, region.slice(0, 1, batches - 1), overlap.slice(0, 0, batches - 1));
         }
-    }
 
-    return Result::SUCCESS;
+        // Get last batch element from overlap.
+
+        ForEach(copy, previous, overlap.slice(0, batches - 1, 1).broadcast(0, previous.shape(0)));
+
+        return Result::SUCCESS;
+    });
 }
 
 JST_OVERLAP_ADD_CPU(JST_INSTANTIATION)
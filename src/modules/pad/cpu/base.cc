@@ -1,5 +1,7 @@
 #include "../generic.cc"
 
+#include "jetstream/memory/devices/cpu/view.hh"
+
 namespace Jetstream {
 
 template<Device D, typename T>
@@ -10,17 +12,21 @@ Result Pad<D, T>::createCompute(const Context&) {
 
 template<Device D, typename T>
 Result Pad<D, T>::compute(const Context&) {
-    std::vector<U64> shape = input.unpadded.shape();
+    const Result result = Memory::CPU::DispatchRank(input.unpadded.rank(), [&](auto rank) {
+        Memory::CPU::TensorView<T, rank> padded(output.padded);
+        Memory::CPU::TensorView<const T, rank> unpadded(input.unpadded);
+
+        Memory::CPU::ForEach([](T& o, const T& x) {
+            o = x;
+        }, padded.slice(config.axis, 0, unpadded.shape(config.axis)), unpadded);
 
-    for (U64 i = 0; i < input.unpadded.size(); i++) {
-        input.unpadded.offset_to_shape(i, shape);
-        output.padded[shape] = input.unpadded[i];
-    }
+        return Result::SUCCESS;
+    });
 
     // TODO: Add offset.
     // TODO: Add blanking.
 
-    return Result::SUCCESS;
+    return result;
 }
 
 JST_PAD_CPU(JST_INSTANTIATION)
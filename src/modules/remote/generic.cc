@@ -575,6 +575,12 @@ Result Remote<D, T>::destroyPresent() {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+bool Remote<D, T>::decoupledPresent() const {
+    // Doesn't touch any state owned by compute.
+    return true;
+}
+
 template<Device D, typename T>
 Result Remote<D, T>::present() {
     if (socketStreaming) {
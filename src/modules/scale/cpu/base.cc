@@ -23,14 +23,23 @@ Result Scale<D, T>::createCompute(const Context&) {
 }
 
 template<Device D, typename T>
-Result Scale<D, T>::compute(const Context&) {
-    for (U64 i = 0; i < input.buffer.size(); i++) {
+Result Scale<D, T>::computeElementwise(const U64& begin, const U64& end) {
+    for (U64 i = begin; i < end; i++) {
         output.buffer[i] = input.buffer[i] * scalingCoeff + offsetCoeff;
     }
 
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+Result Scale<D, T>::compute(const Context& ctx) {
+    const U64 batchSize = numberOfElements / numberOfBatches;
+
+    return ctx.cpu->parallelFor(numberOfBatches, [&](const U64& begin, const U64& end) {
+        return computeElementwise(begin * batchSize, end * batchSize);
+    });
+}
+
 JST_SCALE_CPU(JST_INSTANTIATION)
 JST_SCALE_CPU(JST_BENCHMARK)
     
@@ -12,6 +12,7 @@ Result Scale<D, T>::create() {
     // Calculate parameters.
 
     numberOfElements = input.buffer.size();
+    numberOfBatches = numberOfElements / input.buffer.shape()[input.buffer.rank() - 1];
 
     // Initialize coefficients.
 
@@ -19,7 +20,7 @@ Result Scale<D, T>::create() {
 
     // Allocate output.
 
-    output.buffer = Tensor<D, T>(input.buffer.shape());
+    output.buffer = Tensor<D, T>(input.buffer.shape(), TensorInit::UNINITIALIZED);
 
     return Result::SUCCESS;
 }
@@ -43,4 +44,17 @@ void Scale<D, T>::info() const {
     JST_DEBUG("  Amplitude (min, max): ({}, {})", config.range.min, config.range.max);
 }
 
+template<Device D, typename T>
+bool Scale<D, T>::elementwise() const {
+    return D == Device::CPU;
+}
+
+template<Device D, typename T>
+Result Scale<D, T>::computeRange(const Context&, const U64& begin, const U64& end) {
+    if constexpr (D == Device::CPU) {
+        return computeElementwise(begin, end);
+    }
+    return Result::ERROR;
+}
+
 }  // namespace Jetstream
@@ -1,4 +1,5 @@
 #include "jetstream/modules/soapy.hh"
+#include "jetstream/backend/base.hh"
 
 #include <SoapySDR/Device.hpp>
 #include <SoapySDR/Types.hpp>
@@ -21,6 +22,7 @@ struct Soapy<D, T>::Impl {
     SoapySDR::Stream* soapyStream;
 
     static bool CheckValidRange(const std::vector<SoapySDR::Range>& ranges, const F32& val); 
+    static constexpr const char* StreamFormat();
 };
 
 template<Device D, typename T>
@@ -102,7 +104,16 @@ Result Soapy<D, T>::create() {
     pimpl->soapyDevice->setFrequency(SOAPY_SDR_RX, 0, config.frequency);
     pimpl->soapyDevice->setGainMode(SOAPY_SDR_RX, 0, config.automaticGain);
 
-    pimpl->soapyStream = pimpl->soapyDevice->setupStream(SOAPY_SDR_RX, SOAPY_SDR_CF32, {0}, streamArgs);
+    // Integer samples are streamed as the device produces them and converted downstream.
+
+    const auto formats = pimpl->soapyDevice->getStreamFormats(SOAPY_SDR_RX, 0);
+    if (std::find(formats.begin(), formats.end(), Impl::StreamFormat()) == formats.end()) {
+        JST_ERROR("Device can't stream {} samples.", Impl::StreamFormat());
+        SoapySDR::Device::unmake(pimpl->soapyDevice);
+        return Result::ERROR;
+    }
+
+    pimpl->soapyStream = pimpl->soapyDevice->setupStream(SOAPY_SDR_RX, Impl::StreamFormat(), {0}, streamArgs);
     if (pimpl->soapyStream == nullptr) {
         JST_ERROR("Failed to setup SoapySDR stream.");
         SoapySDR::Device::unmake(pimpl->soapyDevice);
@@ -124,14 +135,25 @@ Result Soapy<D, T>::create() {
     // Allocate circular buffer.
 
     buffer.resize(output.buffer.size() * config.bufferMultiplier);
+    buffer.setOverflowPolicy(Memory::StringToOverflowPolicy(config.overflowPolicy));
+
+    if (config.bufferWatermark > 0.0f) {
+        buffer.setWatermark(buffer.getCapacity() * config.bufferWatermark, [&](const U64& occupancy){
+            JST_WARN("[SOAPY] Buffer is {:.0f}% full. Compute is falling behind.",
+                     occupancy * 100.0 / buffer.getCapacity());
+        });
+    }
 
     // Initialize thread for ingest.
 
     producer = std::thread([&]{
+        Backend::State<Device::CPU>()->placeIoThread();
+
         try {
             JST_CHECK_THROW(soapyThreadLoop());
         } catch(...) {
             errored = true;
+            notifyReady();
             JST_FATAL("[SOAPY] Device thread crashed.");
         }
     });
@@ -147,6 +169,13 @@ Result Soapy<D, T>::destroy() {
         producer.join();
     }
 
+    // The output can't point into the circular buffer past this point.
+    if (borrowedSamples > 0) {
+        JST_CHECK(output.buffer.unalias());
+        buffer.release(borrowedSamples);
+        borrowedSamples = 0;
+    }
+
     pimpl->soapyDevice->deactivateStream(pimpl->soapyStream, 0, 0);
     pimpl->soapyDevice->closeStream(pimpl->soapyStream);
 
@@ -159,15 +188,31 @@ template<Device D, typename T>
 Result Soapy<D, T>::soapyThreadLoop() {
     int flags;
     long long timeNs;
-    CF32 tmp[8192];
-    void *tmp_buffers[] = { tmp };
+    T tmp[8192];
 
-    // TODO: Replace with zero-copy Soapy API.
+    // Samples are read straight into the circular buffer. They only
+    // go through the scratch buffer to be dropped when it's full.
     streaming = true;
     while (streaming) {
-        int ret = pimpl->soapyDevice->readStream(pimpl->soapyStream, tmp_buffers, 8192, flags, timeNs, 1e5);
+        auto span = buffer.reserve(8192);
+        const bool full = span.empty();
+        void* buffers[] = { (full) ? tmp : span.data() };
+        const U64 size = (full) ? 8192 : span.size();
+
+        int ret = pimpl->soapyDevice->readStream(pimpl->soapyStream, buffers, size, flags, timeNs, 1e5);
         if (ret > 0 && streaming && !errored) {
-            buffer.put(tmp, ret);
+            if (full) {
+                buffer.overflow(ret);
+                continue;
+            }
+
+            buffer.commit(ret);
+
+            // Only wake compute once there is a full frame past the one it holds.
+            const U64 borrowed = borrowedSamples.load(std::memory_order_acquire);
+            if (buffer.getOccupancy() >= borrowed + output.buffer.size()) {
+                notifyReady();
+            }
         }
     }
 
@@ -184,6 +229,7 @@ void Soapy<D, T>::info() const {
     JST_DEBUG("  Automatic Gain:         {}", config.automaticGain ? "YES" : "NO");
     JST_DEBUG("  Number of Batches:      {}", config.numberOfBatches);
     JST_DEBUG("  Number of Time Samples: {}", config.numberOfTimeSamples);
+    JST_DEBUG("  Overflow Policy:        {}", config.overflowPolicy);
 }
 
 template<Device D, typename T>
@@ -245,24 +291,63 @@ Result Soapy<D, T>::createCompute(const Context&) {
 
 template<Device D, typename T>
 Result Soapy<D, T>::computeReady() {
-    if (buffer.getOccupancy() < output.buffer.size()) {
-        return buffer.waitBufferOccupancy(output.buffer.size());
+    if (buffer.getOccupancy() < borrowedSamples + output.buffer.size() && !errored) {
+        return Result::TIMEOUT;
     }
 
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+U64 Soapy<D, T>::computeBacklog() const {
+    const U64 borrowed = borrowedSamples;
+    const U64 occupancy = buffer.getOccupancy();
+    const U64 frames = (occupancy > borrowed) ? (occupancy - borrowed) / output.buffer.size() : 0;
+    return (frames > 0) ? (frames - 1) : 0;
+}
+
+template<Device D, typename T>
+F64 Soapy<D, T>::computePeriod() const {
+    return output.buffer.size() / static_cast<F64>(config.sampleRate);
+}
+
 template<Device D, typename T>
 Result Soapy<D, T>::compute(const Context&) {
     if (errored) {
         return Result::ERROR;
     }
 
-    if (buffer.getOccupancy() < output.buffer.size()) {
+    if (buffer.getOccupancy() < borrowedSamples + output.buffer.size()) {
         return Result::SKIP;
     }
 
-    buffer.get(output.buffer.data(), output.buffer.size());
+    // The previous frame was only lent to the graph until now. Releasing it
+    // applies drops the producer is waiting on, so the frame is checked again.
+    if (borrowedSamples > 0) {
+        buffer.release(borrowedSamples);
+        borrowedSamples = 0;
+    }
+
+    // Frames are always contiguous in a mirrored buffer. The output then
+    // points straight at the samples instead of getting a copy.
+    if (buffer.isMirrored()) {
+        if (output.buffer.aliasable()) {
+            const auto span = buffer.peek(output.buffer.size());
+            if (span.size() != output.buffer.size()) {
+                buffer.release(0);
+                JST_CHECK(output.buffer.unalias());
+                return Result::SKIP;
+            }
+            JST_CHECK(output.buffer.alias(const_cast<T*>(span.data())));
+            borrowedSamples = span.size();
+            return Result::SUCCESS;
+        }
+        JST_CHECK(output.buffer.unalias());
+    }
+
+    if (buffer.get(output.buffer.data(), output.buffer.size()) != Result::SUCCESS) {
+        return Result::SKIP;
+    }
 
     return Result::SUCCESS;
 }
@@ -301,6 +386,17 @@ bool Soapy<D, T>::Impl::CheckValidRange(const std::vector<SoapySDR::Range>& rang
     return isSampleRateSupported;
 }
 
+template<Device D, typename T>
+constexpr const char* Soapy<D, T>::Impl::StreamFormat() {
+    if constexpr (std::is_same_v<T, CI8>) {
+        return SOAPY_SDR_CS8;
+    } else if constexpr (std::is_same_v<T, CI16>) {
+        return SOAPY_SDR_CS16;
+    } else {
+        return SOAPY_SDR_CF32;
+    }
+}
+
 JST_SOAPY_CPU(JST_INSTANTIATION)
 
 }  // namespace Jetstream
@@ -1,5 +1,7 @@
 #include "../generic.cc"
 
+#include "jetstream/backend/devices/cpu/helpers.hh"
+
 namespace Jetstream {
 
 template<Device D, typename T>
@@ -25,25 +27,77 @@ Result Spectrogram<D, T>::createCompute(const Context&) {
 }
 
 template<Device D, typename T>
-Result Spectrogram<D, T>::compute(const Context&) {
-    const U64& size = frequencyBins.size();
-    const F32 factor = decayFactor;
-    for (U64 x = 0; x < size; ++x) {
-        frequencyBins[x] *= factor;
+Result Spectrogram<D, T>::compute(const Context& ctx) {
+    if (displayStorage != Memory::DisplayStorage::F32) {
+        return computeQuantized(ctx);
     }
 
-    for (U64 b = 0; b < numberOfBatches; b++) {
-        for (U64 x = 0; x < numberOfElements; x++) {
-            const U16 index = input.buffer[{b, x}] * config.height;
+    const F32 factor = decayFactor;
+    JST_CHECK(ctx.cpu->parallelFor(config.height, [&](const U64& begin, const U64& end) {
+        for (U64 x = begin * numberOfElements; x < end * numberOfElements; ++x) {
+            frequencyBins[x] *= factor;
+        }
+
+        return Result::SUCCESS;
+    }));
+
+    // Batches hit the same bins. Every thread accumulates its own columns.
 
-            if (index < config.height && index > 0) {
-                auto& val = frequencyBins[x + (index * numberOfElements)];
-                val = std::min(val + 0.02, 1.0); 
+    return ctx.cpu->parallelFor(numberOfElements, [&](const U64& begin, const U64& end) {
+        for (U64 b = 0; b < numberOfBatches; b++) {
+            for (U64 x = begin; x < end; x++) {
+                const U16 index = input.buffer[{b, x}] * config.height;
+
+                if (index < config.height && index > 0) {
+                    auto& val = frequencyBins[x + (index * numberOfElements)];
+                    val = std::min(val + 0.02, 1.0); 
+                }
             }
         }
+
+        return Result::SUCCESS;
+    });
+}
+
+template<Device D, typename T>
+Result Spectrogram<D, T>::computeQuantized(const Context& ctx) {
+    U16* bins = reinterpret_cast<U16*>(halfBins.data());
+
+    const F32 factor = decayFactor;
+    JST_CHECK(ctx.cpu->parallelFor(config.height, [&](const U64& begin, const U64& end) {
+        for (U64 x = begin * numberOfElements; x < end * numberOfElements; ++x) {
+            bins[x] = Backend::FloatToHalf(Backend::HalfToFloat(bins[x]) * factor);
+        }
+
+        return Result::SUCCESS;
+    }));
+
+    JST_CHECK(ctx.cpu->parallelFor(numberOfElements, [&](const U64& begin, const U64& end) {
+        for (U64 b = 0; b < numberOfBatches; b++) {
+            for (U64 x = begin; x < end; x++) {
+                const U16 index = input.buffer[{b, x}] * config.height;
+
+                if (index < config.height && index > 0) {
+                    auto& val = bins[x + (index * numberOfElements)];
+                    val = Backend::FloatToHalf(Backend::HalfToFloat(val) + 0.02f);
+                }
+            }
+        }
+
+        return Result::SUCCESS;
+    }));
+
+    if (displayStorage == Memory::DisplayStorage::F16) {
+        return Result::SUCCESS;
     }
 
-    return Result::SUCCESS;
+    U8* packed = reinterpret_cast<U8*>(packedBins.data());
+    return ctx.cpu->parallelFor(config.height, [&](const U64& begin, const U64& end) {
+        const U64 offset = begin * numberOfElements;
+        Backend::QuantizeHalfToU8(bins + offset, packed + offset, (end - begin) * numberOfElements);
+
+        return Result::SUCCESS;
+    });
 }
 
 JST_SPECTROGRAM_CPU(JST_INSTANTIATION)
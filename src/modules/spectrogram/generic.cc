@@ -13,6 +13,7 @@ struct Spectrogram<D, T>::GImpl {
         U32 height;
         F32 offset;
         F32 zoom;
+        U32 format;
     } signalUniforms;
 };
 
@@ -36,9 +37,31 @@ Result Spectrogram<D, T>::create() {
     totalFrequencyBins = numberOfElements * config.height;
     decayFactor = pow(0.999, numberOfBatches);
 
-    // Allocate internal buffers.
+    // Pick the display storage. Only the CPU quantizes.
 
-    frequencyBins = Tensor<D, F32>({numberOfElements, config.height});
+    displayStorage = Memory::StringToDisplayStorage(config.storage);
+    if (D != Device::CPU && displayStorage != Memory::DisplayStorage::F32) {
+        JST_WARN("[SPECTROGRAM] {} storage is only available on the CPU. Using F32.", config.storage);
+        displayStorage = Memory::DisplayStorage::F32;
+    }
+    config.storage = Memory::GetDisplayStorageName(displayStorage);
+
+    // Allocate internal buffers. Quantized bins accumulate as half floats,
+    // which keep the per-frame decay. F16 renders them directly.
+
+    switch (displayStorage) {
+        case Memory::DisplayStorage::F32:
+            frequencyBins = Tensor<D, F32>({numberOfElements, config.height});
+            break;
+        case Memory::DisplayStorage::F16:
+            halfBins = Tensor<D, U32>({Memory::GetDisplayStorageWords(displayStorage, totalFrequencyBins)});
+            packedBins = halfBins;
+            break;
+        case Memory::DisplayStorage::U8:
+            halfBins = Tensor<D, U32>({Memory::GetDisplayStorageWords(Memory::DisplayStorage::F16, totalFrequencyBins)});
+            packedBins = Tensor<D, U32>({Memory::GetDisplayStorageWords(displayStorage, totalFrequencyBins)});
+            break;
+    }
 
     return Result::SUCCESS;
 }
@@ -47,6 +70,7 @@ template<Device D, typename T>
 void Spectrogram<D, T>::info() const {
     JST_DEBUG("  Window Size: [{}, {}]", config.viewSize.width, config.viewSize.height);
     JST_DEBUG("  Height: {}", config.height);
+    JST_DEBUG("  Storage: {}", config.storage);
 }
 
 template<Device D, typename T>
@@ -98,12 +122,15 @@ Result Spectrogram<D, T>::createPresent() {
     }
 
     {
-        auto [buffer, enableZeroCopy] = ConvertToOptimalStorage(window, frequencyBins);
+        // Quantized values are packed in words and unpacked by the shader.
+        auto [buffer, enableZeroCopy] = (displayStorage == Memory::DisplayStorage::F32) ?
+                                            ConvertToOptimalStorage(window, frequencyBins) :
+                                            ConvertToOptimalStorage(window, packedBins);
 
         Render::Buffer::Config cfg;
         cfg.buffer = buffer;
-        cfg.size = frequencyBins.size();
-        cfg.elementByteSize = sizeof(F32);
+        cfg.size = Memory::GetDisplayStorageWords(displayStorage, totalFrequencyBins);
+        cfg.elementByteSize = sizeof(U32);
         cfg.target = Render::Buffer::Target::STORAGE;
         cfg.enableZeroCopy = enableZeroCopy;
         JST_CHECK(window->build(signalBuffer, cfg));
@@ -180,6 +207,7 @@ Result Spectrogram<D, T>::present() {
     gimpl->signalUniforms.height = config.height;
     gimpl->signalUniforms.zoom = 1.0;
     gimpl->signalUniforms.offset = 0.0;
+    gimpl->signalUniforms.format = static_cast<U32>(displayStorage);
 
     signalUniformBuffer->update();
 
@@ -1,19 +1,21 @@
 #include "../generic.cc"
 
-#include "jetstream/backend/devices/cpu/helpers.hh"
+#include "jetstream/memory/devices/cpu/view.hh"
 
 namespace Jetstream {
 
 template<Device D, typename T>
 Result Take<D, T>::compute(const Context&) {
-    std::vector<U64> shape = input.buffer.shape();
-    for (U64 i = 0; i < output.buffer.size(); i++) {
-        output.buffer.offset_to_shape(i, shape);
-        shape[config.axis] = config.index;
-        output.buffer[i] = input.buffer[shape];
-    }
+    return Memory::CPU::DispatchRank(input.buffer.rank(), [&](auto rank) {
+        Memory::CPU::TensorView<T, rank> out(output.buffer);
+        Memory::CPU::TensorView<const T, rank> in(input.buffer);
 
-    return Result::SUCCESS;
+        Memory::CPU::ForEach([](T& o, const T& x) {
+            o = x;
+        }, out, in.slice(config.axis, config.index, 1));
+
+        return Result::SUCCESS;
+    });
 }
 
 JST_TAKE_CPU(JST_INSTANTIATION)
@@ -1,5 +1,7 @@
 #include "../generic.cc"
 
+#include "jetstream/memory/devices/cpu/view.hh"
+
 namespace Jetstream {
 
 template<Device D, typename T>
@@ -10,23 +12,26 @@ Result Unpad<D, T>::createCompute(const Context&) {
 
 template<Device D, typename T>
 Result Unpad<D, T>::compute(const Context&) {
-    std::vector<U64> shape = input.padded.shape();
-    const U64 pad_offset = shape[config.axis] - config.size;
+    const Result result = Memory::CPU::DispatchRank(input.padded.rank(), [&](auto rank) {
+        const auto copy = [](T& o, const T& x) {
+            o = x;
+        };
+
+        Memory::CPU::TensorView<const T, rank> padded(input.padded);
+        Memory::CPU::TensorView<T, rank> unpadded(output.unpadded);
+        Memory::CPU::TensorView<T, rank> pad(output.pad);
 
-    for (U64 i = 0; i < input.padded.size(); i++) {
-        input.padded.offset_to_shape(i, shape);
+        const U64 padOffset = padded.shape(config.axis) - config.size;
 
-        if (shape[config.axis] >= pad_offset) {
-            shape[config.axis] -= pad_offset;
-            output.pad[shape] = input.padded[i];
-        } else {
-            output.unpadded[shape] = input.padded[i];
-        }
-    }
+        Memory::CPU::ForEach(copy, unpadded, padded.slice(config.axis, 0, padOffset));
+        Memory::CPU::ForEach(copy, pad, padded.slice(config.axis, padOffset, config.size));
+
+        return Result::SUCCESS;
+    });
 
     // TODO: Add offset.
 
-    return Result::SUCCESS;
+    return result;
 }
 
 JST_UNPAD_CPU(JST_INSTANTIATION)
@@ -1,5 +1,7 @@
 #include "../generic.cc"
 
+#include "jetstream/backend/devices/cpu/helpers.hh"
+
 namespace Jetstream {
 
 template<Device D, typename T>
@@ -24,9 +26,12 @@ Result Waterfall<D, T>::underlyingCompute(const Context&) {
     const auto offset = inc * fftSize;
     const auto size = JST_MIN(totalSize, (config.height - inc) * fftSize);
 
-    std::copy(input.buffer.begin(), input.buffer.begin() + size, frequencyBins.data() + offset);
+    void* bins = (displayStorage == Memory::DisplayStorage::F32) ? static_cast<void*>(frequencyBins.data()) :
+                                                                    static_cast<void*>(packedBins.data());
+
+    Backend::StoreDisplayValues(displayStorage, input.buffer.begin(), bins, offset, size);
     if (size < totalSize) {
-        std::copy(input.buffer.begin() + size, input.buffer.end(), frequencyBins.data());
+        Backend::StoreDisplayValues(displayStorage, input.buffer.begin() + size, bins, 0, totalSize - size);
     }
 
     return Result::SUCCESS;
@@ -16,6 +16,7 @@ struct Waterfall<D, T>::GImpl {
         float offset;
         float zoom;
         bool interpolate;
+        int format;
     } signalUniforms;
 };
 
@@ -37,9 +38,23 @@ Result Waterfall<D, T>::create() {
     numberOfElements = input.buffer.shape()[last_axis];
     numberOfBatches = (input.buffer.rank() == 2) ? input.buffer.shape()[0] : 1;
 
+    // Pick the display storage. Only the CPU quantizes.
+
+    displayStorage = Memory::StringToDisplayStorage(config.storage);
+    if (D != Device::CPU && displayStorage != Memory::DisplayStorage::F32) {
+        JST_WARN("[WATERFALL] {} storage is only available on the CPU. Using F32.", config.storage);
+        displayStorage = Memory::DisplayStorage::F32;
+    }
+    config.storage = Memory::GetDisplayStorageName(displayStorage);
+
     // Allocate internal buffers.
 
-    frequencyBins = Tensor<D, F32>({numberOfElements,  config.height});
+    if (displayStorage == Memory::DisplayStorage::F32) {
+        frequencyBins = Tensor<D, F32>({numberOfElements,  config.height});
+    } else {
+        const U64 words = Memory::GetDisplayStorageWords(displayStorage, numberOfElements * config.height);
+        packedBins = Tensor<D, U32>({words});
+    }
 
     return Result::SUCCESS;
 }
@@ -50,6 +65,7 @@ void Waterfall<D, T>::info() const {
     JST_DEBUG("  Zoom:         {}", config.zoom);
     JST_DEBUG("  Interpolate:  {}", config.interpolate ? "YES" : "NO");
     JST_DEBUG("  Height:       {}", config.height);
+    JST_DEBUG("  Storage:      {}", config.storage);
     JST_DEBUG("  Window Size:  [{}, {}]", config.viewSize.width, config.viewSize.height);
 }
 
@@ -102,12 +118,15 @@ Result Waterfall<D, T>::createPresent() {
     }
 
     {
-        auto [buffer, enableZeroCopy] = ConvertToOptimalStorage(window, frequencyBins);
+        // Quantized values are packed in words and unpacked by the shader.
+        auto [buffer, enableZeroCopy] = (displayStorage == Memory::DisplayStorage::F32) ?
+                                            ConvertToOptimalStorage(window, frequencyBins) :
+                                            ConvertToOptimalStorage(window, packedBins);
 
         Render::Buffer::Config cfg;
         cfg.buffer = buffer;
-        cfg.size = frequencyBins.size();
-        cfg.elementByteSize = sizeof(F32);
+        cfg.size = Memory::GetDisplayStorageWords(displayStorage, numberOfElements * config.height);
+        cfg.elementByteSize = sizeof(U32);
         cfg.target = Render::Buffer::Target::STORAGE;
         cfg.enableZeroCopy = enableZeroCopy;
         JST_CHECK(window->build(signalBuffer, cfg));
@@ -176,29 +195,46 @@ Result Waterfall<D, T>::destroyPresent() {
     return Result::SUCCESS;
 }
 
+template<Device D, typename T>
+bool Waterfall<D, T>::decoupledPresent() const {
+    // Compute only writes rows past the published index.
+    return D == Device::CPU;
+}
+
 template<Device D, typename T>
 Result Waterfall<D, T>::present() {
+    // Rows before the published index are complete.
+    const int head = inc.load(std::memory_order_acquire);
+
     int start = last;
-    int blocks = (inc - last);
+    int blocks = (head - last);
+
+    // Quantized rows can share a word with their neighbours, so updates cover whole words.
+    const auto updateRows = [&](const U64& row, const U64& rows) {
+        const U64 begin = (row * numberOfElements * Memory::GetDisplayStorageByteSize(displayStorage)) / 4;
+        const U64 end = Memory::GetDisplayStorageWords(displayStorage, (row + rows) * numberOfElements);
+        signalBuffer->update(begin, end - begin);
+    };
 
     // TODO: Fix this horrible thing.
     if (blocks < 0) {
         blocks = config.height - last;
 
-        signalBuffer->update(start * numberOfElements, blocks * numberOfElements);
+        updateRows(start, blocks);
 
         start = 0;
-        blocks = inc;
+        blocks = head;
     }
 
-    signalBuffer->update(start * numberOfElements, blocks * numberOfElements);
-    last = inc;
+    updateRows(start, blocks);
+    last = head;
 
     gimpl->signalUniforms.zoom = config.zoom;
     gimpl->signalUniforms.width = numberOfElements;
     gimpl->signalUniforms.height = config.height;
     gimpl->signalUniforms.interpolate = config.interpolate;
-    gimpl->signalUniforms.index = inc / (float)gimpl->signalUniforms.height;
+    gimpl->signalUniforms.format = static_cast<int>(displayStorage);
+    gimpl->signalUniforms.index = head / (float)gimpl->signalUniforms.height;
     gimpl->signalUniforms.offset = config.offset / (float)config.viewSize.width;
     gimpl->signalUniforms.maxSize = gimpl->signalUniforms.width * gimpl->signalUniforms.height;
 
@@ -215,7 +251,7 @@ Result Waterfall<D, T>::createCompute(const Context&) {
 template<Device D, typename T>
 Result Waterfall<D, T>::compute(const Context& ctx) {
     auto res = underlyingCompute(ctx);
-    inc = (inc + numberOfBatches) % config.height;
+    inc.store((inc.load(std::memory_order_relaxed) + numberOfBatches) % config.height, std::memory_order_release);
     return res;
 }
 
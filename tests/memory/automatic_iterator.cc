@@ -0,0 +1,203 @@
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/module.hh"
+#include "jetstream/memory/base.hh"
+#include "jetstream/memory/devices/cpu/helpers.hh"
+
+using namespace Jetstream;
+
+// Exposes the input initialization of modules.
+struct InputProbe : public Module {
+    using Module::InitInput;
+};
+
+// Fills a tensor with its flat index through the regular indexing.
+static void Fill(Tensor<Device::CPU, F32>& tensor) {
+    for (U64 i = 0; i < tensor.size(); i++) {
+        std::vector<U64> coords(tensor.rank());
+        U64 rest = i;
+        for (I64 d = tensor.rank() - 1; d >= 0; d--) {
+            coords[d] = rest % tensor.shape()[d];
+            rest /= tensor.shape()[d];
+        }
+        tensor[coords] = static_cast<F32>(i + 1);
+    }
+}
+
+// Compares the iterator against coordinate-by-coordinate indexing.
+static bool Matches(Tensor<Device::CPU, F32>& a, Tensor<Device::CPU, F32>& b) {
+    Tensor<Device::CPU, F32> c(a.shape());
+
+    Memory::CPU::AutomaticIterator([](const auto& x, const auto& y, auto& z) {
+        z = x * y;
+    }, a, b, c);
+
+    for (U64 i = 0; i < c.size(); i++) {
+        std::vector<U64> coords(c.rank());
+        U64 rest = i;
+        for (I64 d = c.rank() - 1; d >= 0; d--) {
+            coords[d] = rest % c.shape()[d];
+            rest /= c.shape()[d];
+        }
+        if (c[coords] != a[coords] * b[coords]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST_CASE("AutomaticIterator Tests", "[AutomaticIterator]") {
+    SECTION("Contiguous") {
+        Tensor<Device::CPU, F32> a({4, 6, 5});
+        Tensor<Device::CPU, F32> b({4, 6, 5});
+        Fill(a);
+        Fill(b);
+
+        REQUIRE(Matches(a, b));
+    }
+
+    SECTION("Broadcast") {
+        Tensor<Device::CPU, F32> a({8, 7});
+        Tensor<Device::CPU, F32> b({1, 7});
+        Tensor<Device::CPU, F32> c({8, 1});
+        Fill(a);
+        Fill(b);
+        Fill(c);
+
+        REQUIRE(b.broadcast_to({8, 7}) == Result::SUCCESS);
+        REQUIRE(c.broadcast_to({8, 7}) == Result::SUCCESS);
+
+        REQUIRE(Matches(a, b));
+        REQUIRE(Matches(a, c));
+        REQUIRE(Matches(b, c));
+    }
+
+    SECTION("Sliced") {
+        Tensor<Device::CPU, F32> a({3, 2, 9, 4});
+        Tensor<Device::CPU, F32> b({3, 9, 4});
+        Fill(a);
+        Fill(b);
+
+        REQUIRE(a.slice({{}, 1, {1, 8, 2}, {}}) == Result::SUCCESS);
+        REQUIRE(b.slice({{}, {0, 7, 2}, {}}) == Result::SUCCESS);
+
+        REQUIRE(Matches(a, b));
+    }
+
+    SECTION("Permuted") {
+        Tensor<Device::CPU, F32> a({4, 6, 5});
+        Tensor<Device::CPU, F32> b({5, 4, 6});
+        Fill(a);
+        Fill(b);
+
+        REQUIRE(a.permutation({2, 0, 1}) == Result::SUCCESS);
+        REQUIRE(a.shape() == std::vector<U64>{5, 4, 6});
+        REQUIRE(!a.contiguous());
+        REQUIRE(a.permutation({0, 0, 1}) == Result::ERROR);
+
+        REQUIRE(Matches(a, b));
+    }
+
+    SECTION("Contiguous Copy") {
+        Tensor<Device::CPU, F32> a({3, 8});
+        Fill(a);
+
+        REQUIRE(a.permutation({1, 0}) == Result::SUCCESS);
+
+        auto copy = a.contiguous_copy();
+        REQUIRE(copy.contiguous());
+        REQUIRE(copy.has_source());
+        REQUIRE(copy[{5, 2}] == a[{5, 2}]);
+
+        // The copy only follows the view when materialized.
+        a[{5, 2}] = -1.0f;
+        REQUIRE(copy[{5, 2}] != -1.0f);
+        REQUIRE(copy.materialize() == Result::SUCCESS);
+        REQUIRE(copy[{5, 2}] == -1.0f);
+    }
+
+    SECTION("In-Place Input Copy") {
+        Tensor<Device::CPU, F32> a({4, 8});
+        a.set_locale({"block", "module", "buffer"});
+        Fill(a);
+
+        auto input = a;
+        REQUIRE(InputProbe::InitInput(input, Taint::IN_PLACE) == Result::SUCCESS);
+        REQUIRE(input.has_source());
+        REQUIRE(input.data() != a.data());
+        REQUIRE(input[{1, 3}] == a[{1, 3}]);
+
+        // Writes of the in-place module don't reach the other readers.
+        input[{1, 3}] = -1.0f;
+        REQUIRE(a[{1, 3}] == 12.0f);
+        REQUIRE(input.materialize() == Result::SUCCESS);
+        REQUIRE(input[{1, 3}] == 12.0f);
+
+        // Other modules keep reading the Vector itself.
+        auto reader = a;
+        REQUIRE(InputProbe::InitInput(reader, Taint::CLEAN) == Result::SUCCESS);
+        REQUIRE(!reader.has_source());
+        REQUIRE(reader.data() == a.data());
+    }
+
+    SECTION("High Rank") {
+        Tensor<Device::CPU, F32> a({2, 3, 4, 5, 6});
+        Tensor<Device::CPU, F32> b({2, 1, 4, 1, 6});
+        Fill(a);
+        Fill(b);
+
+        REQUIRE(b.broadcast_to({2, 3, 4, 5, 6}) == Result::SUCCESS);
+
+        REQUIRE(Matches(a, b));
+    }
+
+    SECTION("Reduction Into Broadcast Output") {
+        Tensor<Device::CPU, F32> input({4, 3});
+        Tensor<Device::CPU, F32> sum({1, 3});
+        Fill(input);
+
+        Tensor<Device::CPU, F32> broadcasted(sum);
+        REQUIRE(broadcasted.broadcast_to({4, 3}) == Result::SUCCESS);
+
+        Memory::CPU::AutomaticIterator([](auto& a, const auto& b) {
+            a += b;
+        }, broadcasted, input);
+
+        REQUIRE(sum[0] == 1 + 4 + 7 + 10);
+        REQUIRE(sum[2] == 3 + 6 + 9 + 12);
+    }
+
+    SECTION("Span Mode") {
+        Tensor<Device::CPU, F32> a({6, 8});
+        Tensor<Device::CPU, F32> b({1, 8});
+        REQUIRE(b.broadcast_to({6, 8}) == Result::SUCCESS);
+
+        U64 calls = 0;
+        U64 elements = 0;
+        Memory::CPU::AutomaticSpanIterator([&](const U64& length, const auto& x, const auto& y) {
+            REQUIRE(x.stride == 1);
+            REQUIRE(y.stride == 1);
+            calls += 1;
+            elements += length;
+        }, a, b);
+
+        REQUIRE(calls == 6);
+        REQUIRE(elements == 48);
+
+        // Contiguous tensors are a single run.
+        calls = 0;
+        Memory::CPU::AutomaticSpanIterator([&](const U64& length, const auto&) {
+            REQUIRE(length == 48);
+            calls += 1;
+        }, a);
+        REQUIRE(calls == 1);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
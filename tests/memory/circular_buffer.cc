@@ -0,0 +1,130 @@
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/utils/circular_buffer.hh"
+
+using namespace Jetstream;
+
+TEST_CASE("CircularBuffer Class Tests", "[CircularBuffer]") {
+    const std::vector<F32> first = {0, 1, 2, 3};
+    const std::vector<F32> second = {4, 5, 6};
+
+    SECTION("Put and Get") {
+        Memory::CircularBuffer<F32> buffer(4);
+
+        REQUIRE(buffer.put(first.data(), 4) == Result::SUCCESS);
+        REQUIRE(buffer.isFull());
+
+        std::vector<F32> data(4);
+        REQUIRE(buffer.get(data.data(), 4) == Result::SUCCESS);
+        REQUIRE(data == first);
+        REQUIRE(buffer.isEmpty());
+    }
+
+    SECTION("Overflow Drops Oldest") {
+        Memory::CircularBuffer<F32> buffer(4);
+        REQUIRE(buffer.getOverflowPolicy() == Memory::OverflowPolicy::DROP_OLDEST);
+
+        buffer.put(first.data(), 4);
+        REQUIRE(buffer.put(second.data(), 3) == Result::SUCCESS);
+        REQUIRE(buffer.getOverflows() == 1);
+        REQUIRE(buffer.getDroppedElements() == 3);
+        REQUIRE(buffer.getOccupancy() == 4);
+
+        std::vector<F32> data(4);
+        buffer.get(data.data(), 4);
+        REQUIRE(data == std::vector<F32>({3, 4, 5, 6}));
+    }
+
+    SECTION("Oversized Write Keeps Newest") {
+        Memory::CircularBuffer<F32> buffer(4);
+        const std::vector<F32> large = {10, 11, 12, 13, 14, 15};
+
+        buffer.put(first.data(), 2);
+        REQUIRE(buffer.put(large.data(), 6) == Result::SUCCESS);
+        REQUIRE(buffer.getOverflows() == 1);
+        REQUIRE(buffer.getDroppedElements() == 4);
+        REQUIRE(buffer.getOccupancy() == 4);
+
+        std::vector<F32> data(4);
+        buffer.get(data.data(), 4);
+        REQUIRE(data == std::vector<F32>({12, 13, 14, 15}));
+
+        buffer.setOverflowPolicy(Memory::OverflowPolicy::DROP_NEWEST);
+        REQUIRE(buffer.put(large.data(), 6) == Result::ERROR);
+        REQUIRE(buffer.isEmpty());
+    }
+
+    SECTION("Overflow Drops Newest") {
+        Memory::CircularBuffer<F32> buffer(4);
+        buffer.setOverflowPolicy(Memory::OverflowPolicy::DROP_NEWEST);
+
+        buffer.put(first.data(), 4);
+        REQUIRE(buffer.put(second.data(), 3) == Result::SUCCESS);
+        REQUIRE(buffer.getOverflows() == 1);
+        REQUIRE(buffer.getDroppedElements() == 3);
+
+        std::vector<F32> data(4);
+        buffer.get(data.data(), 4);
+        REQUIRE(data == first);
+    }
+
+    SECTION("Overflow Blocks") {
+        Memory::CircularBuffer<F32> buffer(4);
+        buffer.setOverflowPolicy(Memory::OverflowPolicy::BLOCK, std::chrono::milliseconds(5));
+
+        buffer.put(first.data(), 4);
+        REQUIRE(buffer.put(second.data(), 3) == Result::SUCCESS);
+        REQUIRE(buffer.getOverflows() == 1);
+        REQUIRE(buffer.getBlockedTime() >= 0.005);
+
+        buffer.setOverflowPolicy(Memory::OverflowPolicy::BLOCK, std::chrono::seconds(10));
+
+        std::thread consumer([&]{
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            std::vector<F32> data(3);
+            buffer.get(data.data(), 3);
+        });
+
+        REQUIRE(buffer.put(second.data(), 3) == Result::SUCCESS);
+        consumer.join();
+
+        REQUIRE(buffer.getOverflows() == 1);
+
+        std::vector<F32> data(4);
+        buffer.get(data.data(), 4);
+        REQUIRE(data == std::vector<F32>({3, 4, 5, 6}));
+    }
+
+    SECTION("Watermark Fires on Rising Edge") {
+        Memory::CircularBuffer<F32> buffer(8);
+
+        U64 calls = 0;
+        buffer.setWatermark(6, [&](const U64& occupancy) {
+            calls += 1;
+            REQUIRE(occupancy >= 6);
+        });
+
+        buffer.put(first.data(), 4);
+        REQUIRE(calls == 0);
+        buffer.put(second.data(), 3);
+        REQUIRE(calls == 1);
+
+        std::vector<F32> data(6);
+        buffer.get(data.data(), 6);
+        buffer.put(first.data(), 1);
+        REQUIRE(calls == 1);
+        buffer.put(first.data(), 4);
+        REQUIRE(calls == 2);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
@@ -0,0 +1,106 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/utils/juggler.hh"
+
+using namespace Jetstream;
+
+TEST_CASE("Juggler Class Tests", "[Juggler]") {
+    SECTION("Objects Are Constructed With Arguments") {
+        Memory::Juggler<std::vector<U64>> pool(3, 16, 7);
+
+        REQUIRE(pool.getCapacity() == 3);
+
+        auto object = pool.get();
+        REQUIRE(object != nullptr);
+        REQUIRE(object->size() == 16);
+        REQUIRE((*object)[15] == 7);
+    }
+
+    SECTION("Released Objects Are Reused") {
+        Memory::Juggler<U64> pool(2);
+
+        auto first = pool.get();
+        auto second = pool.get();
+        REQUIRE(first != nullptr);
+        REQUIRE(second != nullptr);
+        REQUIRE(first != second);
+        REQUIRE(pool.getInUse() == 2);
+
+        REQUIRE(pool.get() == nullptr);
+        REQUIRE(pool.getExhausted() == 1);
+
+        U64* address = first.get();
+        auto copy = first;
+        first.reset();
+        REQUIRE(pool.getInUse() == 2);
+
+        copy.reset();
+        REQUIRE(pool.getInUse() == 1);
+
+        auto third = pool.get();
+        REQUIRE(third.get() == address);
+        REQUIRE(pool.getPeakInUse() == 2);
+    }
+
+    SECTION("Weak Pointers Hold the Slot") {
+        Memory::Juggler<U64> pool(1);
+
+        auto object = pool.get();
+        std::weak_ptr<U64> weak = object;
+        object.reset();
+
+        REQUIRE(weak.expired());
+        REQUIRE(pool.get() == nullptr);
+
+        weak.reset();
+        REQUIRE(pool.get() != nullptr);
+    }
+
+    SECTION("Concurrent Lending") {
+        Memory::Juggler<U64> pool(8, 0);
+        std::atomic<U64> failures{0};
+
+        std::vector<std::thread> threads;
+        for (U64 t = 0; t < 4; t++) {
+            threads.emplace_back([&]{
+                for (U64 i = 0; i < 10000; i++) {
+                    auto a = pool.get();
+                    auto b = pool.get();
+                    if (!a || !b || a == b) {
+                        failures += 1;
+                        continue;
+                    }
+                    *a += 1;
+                    *b += 1;
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        REQUIRE(failures == 0);
+        REQUIRE(pool.getInUse() == 0);
+        REQUIRE(pool.getPeakInUse() <= 8);
+
+        U64 total = 0;
+        std::vector<std::shared_ptr<U64>> objects;
+        for (U64 i = 0; i < 8; i++) {
+            objects.push_back(pool.get());
+            total += *objects.back();
+        }
+        REQUIRE(total == 80000);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
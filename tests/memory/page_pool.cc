@@ -0,0 +1,138 @@
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/macros.hh"
+#include "jetstream/memory/utils/page_pool.hh"
+
+using namespace Jetstream;
+
+TEST_CASE("PagePool Class Tests", "[PagePool]") {
+    const U64 pageSize = JST_PAGESIZE();
+
+    SECTION("Size Classes") {
+        REQUIRE(Memory::PagePool::SizeClass(0) == pageSize);
+        REQUIRE(Memory::PagePool::SizeClass(1) == pageSize);
+        REQUIRE(Memory::PagePool::SizeClass(3 * pageSize + 1) == 4 * pageSize);
+        REQUIRE(Memory::PagePool::SizeClass(9 * pageSize) == 10 * pageSize);
+        REQUIRE(Memory::PagePool::SizeClass(1000 * pageSize) == 1024 * pageSize);
+
+        // At most a quarter of every class is padding.
+        for (U64 pages = 1; pages < 5000; pages += 7) {
+            const U64 size = Memory::PagePool::SizeClass(pages * pageSize);
+            REQUIRE(size % pageSize == 0);
+            REQUIRE(size >= pages * pageSize);
+            REQUIRE(size * 4 <= pages * pageSize * 5);
+        }
+    }
+
+    SECTION("Freed Allocations Are Reused") {
+        Memory::PagePool pool;
+
+        void* first = pool.allocate(10 * pageSize);
+        REQUIRE(first != nullptr);
+        REQUIRE(JST_IS_ALIGNED(first));
+        REQUIRE(pool.getMisses() == 1);
+
+        pool.free(first);
+        REQUIRE(pool.getCachedBytes() == Memory::PagePool::SizeClass(10 * pageSize));
+
+        void* second = pool.allocate(9 * pageSize + 1);
+        REQUIRE(second == first);
+        REQUIRE(pool.getHits() == 1);
+        REQUIRE(pool.getCachedBytes() == 0);
+
+        void* third = pool.allocate(20 * pageSize);
+        REQUIRE(third != first);
+        REQUIRE(pool.getMisses() == 2);
+
+        pool.free(second);
+        pool.free(third);
+    }
+
+    SECTION("Capacity Limits the Cache") {
+        Memory::PagePool pool;
+        pool.configure({.capacity = 4 * pageSize});
+
+        void* small = pool.allocate(4 * pageSize);
+        void* large = pool.allocate(8 * pageSize);
+
+        pool.free(small);
+        pool.free(large);
+        REQUIRE(pool.getCachedBytes() == 4 * pageSize);
+
+        pool.trim();
+        REQUIRE(pool.getCachedBytes() == 0);
+        REQUIRE(pool.allocate(4 * pageSize) != nullptr);
+        REQUIRE(pool.getHits() == 0);
+    }
+
+    SECTION("Large Allocations Are Cleared Lazily") {
+        Memory::PagePool pool;
+
+        bool zeroed = false;
+        auto* data = static_cast<U8*>(pool.allocate(Memory::PagePool::MappedSize, zeroed));
+        REQUIRE(data != nullptr);
+
+        if (zeroed) {
+            for (U64 i = 0; i < Memory::PagePool::MappedSize; i += pageSize) {
+                REQUIRE(data[i] == 0);
+            }
+        }
+        data[0] = 1;
+
+        // Cached memory keeps its content.
+        pool.free(data);
+        REQUIRE(pool.allocate(Memory::PagePool::MappedSize, zeroed) == data);
+        REQUIRE(zeroed == false);
+        pool.free(data);
+    }
+
+    SECTION("Huge Pages") {
+        Memory::PagePool pool;
+        pool.configure({.transparentHugePages = true, .explicitHugePages = true});
+
+        const U64 size = Memory::PagePool::HugePageSize + pageSize;
+        auto* data = static_cast<U8*>(pool.allocate(size));
+        REQUIRE(data != nullptr);
+
+        data[0] = 1;
+        data[size - 1] = 2;
+        REQUIRE(data[size - 1] == 2);
+
+        pool.free(data);
+        REQUIRE(pool.getCachedBytes() % Memory::PagePool::HugePageSize == 0);
+        REQUIRE(pool.allocate(size) == data);
+        pool.free(data);
+    }
+
+    SECTION("Concurrent Allocations") {
+        Memory::PagePool pool;
+
+        std::vector<std::thread> threads;
+        for (U64 t = 0; t < 4; t++) {
+            threads.emplace_back([&pool, t, pageSize]{
+                for (U64 i = 0; i < 1000; i++) {
+                    auto* data = static_cast<U8*>(pool.allocate(((i + t) % 16 + 1) * pageSize));
+                    data[0] = i;
+                    pool.free(data);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        REQUIRE(pool.getHits() + pool.getMisses() == 4000);
+        REQUIRE(pool.getMisses() < 4000);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
@@ -0,0 +1,423 @@
+#include <thread>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/utils/spsc_circular_buffer.hh"
+
+using namespace Jetstream;
+
+TEST_CASE("SpscCircularBuffer Class Tests", "[SpscCircularBuffer]") {
+    SECTION("Capacity Fills Whole Pages") {
+        Memory::SpscCircularBuffer<U64> buffer(8);
+
+        REQUIRE(buffer.getCapacity() >= 8);
+        REQUIRE((buffer.getCapacity() * sizeof(U64)) % Memory::MirroredMemory::Granularity() == 0);
+    }
+
+    SECTION("Reserve and Commit") {
+        Memory::SpscCircularBuffer<U64> buffer(8);
+        const U64 capacity = buffer.getCapacity();
+
+        auto span = buffer.reserve(5);
+        REQUIRE(span.size() == 5);
+        for (U64 i = 0; i < span.size(); i++) {
+            span[i] = i;
+        }
+
+        REQUIRE(buffer.getOccupancy() == 0);
+        buffer.commit(5);
+        REQUIRE(buffer.getOccupancy() == 5);
+
+        REQUIRE(buffer.reserve(capacity).size() == capacity - 5);
+    }
+
+    SECTION("Peek and Release") {
+        Memory::SpscCircularBuffer<U64> buffer(8);
+
+        REQUIRE(buffer.peek(4).empty());
+
+        auto span = buffer.reserve(4);
+        for (U64 i = 0; i < span.size(); i++) {
+            span[i] = i + 10;
+        }
+        buffer.commit(4);
+
+        const auto data = buffer.peek(8);
+        REQUIRE(data.size() == 4);
+        REQUIRE(data[0] == 10);
+        REQUIRE(data[3] == 13);
+
+        buffer.release(2);
+        REQUIRE(buffer.getOccupancy() == 2);
+        REQUIRE(buffer.peek(8)[0] == 12);
+    }
+
+    SECTION("Spans Across the End") {
+        Memory::SpscCircularBuffer<U64> buffer(8);
+        const U64 capacity = buffer.getCapacity();
+
+        buffer.reserve(capacity - 2);
+        buffer.commit(capacity - 2);
+        buffer.peek(capacity - 2);
+        buffer.release(capacity - 2);
+
+        if (buffer.isMirrored()) {
+            auto span = buffer.reserve(6);
+            REQUIRE(span.size() == 6);
+            for (U64 i = 0; i < span.size(); i++) {
+                span[i] = i;
+            }
+            buffer.commit(6);
+
+            const auto data = buffer.peek(6);
+            REQUIRE(data.size() == 6);
+            REQUIRE(data[5] == 5);
+        } else {
+            REQUIRE(buffer.reserve(6).size() == 2);
+            buffer.commit(2);
+            REQUIRE(buffer.reserve(6).size() == 4);
+            buffer.commit(4);
+
+            REQUIRE(buffer.peek(6).size() == 2);
+            buffer.release(2);
+            REQUIRE(buffer.peek(6).size() == 4);
+        }
+    }
+
+    SECTION("Full Buffer Drops Newest") {
+        Memory::SpscCircularBuffer<U64> buffer(4);
+        const U64 capacity = buffer.getCapacity();
+        buffer.setOverflowPolicy(Memory::OverflowPolicy::DROP_NEWEST);
+
+        buffer.reserve(capacity);
+        buffer.commit(capacity);
+
+        REQUIRE(buffer.isFull());
+        REQUIRE(buffer.reserve(1).empty());
+
+        buffer.overflow(3);
+        REQUIRE(buffer.getOverflows() == 1);
+        REQUIRE(buffer.getDroppedElements() == 3);
+
+        buffer.peek(1);
+        buffer.release(1);
+        REQUIRE(buffer.reserve(4).size() == 1);
+    }
+
+    SECTION("Full Buffer Drops Oldest") {
+        Memory::SpscCircularBuffer<U64> buffer(4);
+        const U64 capacity = buffer.getCapacity();
+
+        auto span = buffer.reserve(capacity);
+        for (U64 i = 0; i < span.size(); i++) {
+            span[i] = i;
+        }
+        buffer.commit(capacity);
+
+        // The incoming block is kept and the oldest elements make room for it.
+        span = buffer.reserve(3);
+        REQUIRE(span.size() == 3);
+        REQUIRE(buffer.getOverflows() == 1);
+        REQUIRE(buffer.getDroppedElements() == 3);
+        REQUIRE(buffer.getOccupancy() == capacity - 3);
+
+        for (U64 i = 0; i < span.size(); i++) {
+            span[i] = capacity + i;
+        }
+        buffer.commit(3);
+
+        const auto data = buffer.peek(1);
+        REQUIRE(data.size() == 1);
+        REQUIRE(data[0] == 3);
+        REQUIRE(buffer.getDroppedElements() == 3);
+    }
+
+    SECTION("Peek After Dropping Oldest") {
+        Memory::SpscCircularBuffer<U64> buffer(4);
+        const U64 capacity = buffer.getCapacity();
+
+        auto span = buffer.reserve(capacity);
+        for (U64 i = 0; i < span.size(); i++) {
+            span[i] = i;
+        }
+        buffer.commit(capacity);
+
+        REQUIRE(buffer.peek(capacity).size() == capacity);
+        buffer.release(0);
+
+        span = buffer.reserve(3);
+        for (U64 i = 0; i < span.size(); i++) {
+            span[i] = capacity + i;
+        }
+        buffer.commit(3);
+
+        // The drop moves the head past the tail the consumer saw last.
+        const auto data = buffer.peek(capacity);
+        REQUIRE(data.size() == capacity);
+        REQUIRE(data[0] == 3);
+        REQUIRE(data[capacity - 1] == capacity + 2);
+
+        buffer.release(data.size());
+        REQUIRE(buffer.isEmpty());
+        REQUIRE(buffer.getDroppedElements() == 3);
+    }
+
+    SECTION("Leased Elements Are Dropped on Release") {
+        Memory::SpscCircularBuffer<U64> buffer(4);
+        const U64 capacity = buffer.getCapacity();
+        buffer.setOverflowPolicy(Memory::OverflowPolicy::DROP_OLDEST, std::chrono::seconds(10));
+
+        auto span = buffer.reserve(capacity);
+        for (U64 i = 0; i < span.size(); i++) {
+            span[i] = i;
+        }
+        buffer.commit(capacity);
+
+        REQUIRE(buffer.peek(2).size() == 2);
+
+        // The producer waits for the consumer instead of dropping leased elements.
+        U64 reserved = 0;
+        std::thread producer([&]{
+            auto span = buffer.reserve(3);
+            for (U64 i = 0; i < span.size(); i++) {
+                span[i] = capacity + i;
+            }
+            reserved = span.size();
+            buffer.commit(span.size());
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        buffer.release(2);
+        producer.join();
+
+        // Releasing frees two elements. Only the missing ones are dropped.
+        REQUIRE(reserved >= 2);
+        REQUIRE(buffer.getDroppedElements() == reserved - 2);
+        REQUIRE(buffer.getOccupancy() == capacity);
+
+        const auto data = buffer.peek(capacity);
+        REQUIRE(data[0] == 2 + buffer.getDroppedElements());
+        REQUIRE(data[capacity - 1] == capacity + reserved - 1);
+    }
+
+    SECTION("Full Buffer Blocks Until Timeout") {
+        Memory::SpscCircularBuffer<U64> buffer(4);
+        const U64 capacity = buffer.getCapacity();
+        buffer.setOverflowPolicy(Memory::OverflowPolicy::BLOCK, std::chrono::milliseconds(5));
+
+        buffer.reserve(capacity);
+        buffer.commit(capacity);
+
+        REQUIRE(buffer.reserve(1).empty());
+        REQUIRE(buffer.getBlockedTime() >= 0.005);
+
+        std::thread consumer([&]{
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            buffer.peek(2);
+            buffer.release(2);
+        });
+
+        buffer.setOverflowPolicy(Memory::OverflowPolicy::BLOCK, std::chrono::seconds(10));
+        REQUIRE(buffer.reserve(2).size() == 2);
+
+        consumer.join();
+    }
+
+    SECTION("Watermark Fires on Rising Edge") {
+        Memory::SpscCircularBuffer<U64> buffer(8);
+        const U64 capacity = buffer.getCapacity();
+
+        U64 calls = 0;
+        U64 level = 0;
+        buffer.setWatermark(capacity / 2, [&](const U64& occupancy) {
+            calls += 1;
+            level = occupancy;
+        });
+
+        buffer.reserve(capacity / 2 - 1);
+        buffer.commit(capacity / 2 - 1);
+        REQUIRE(calls == 0);
+
+        buffer.reserve(2);
+        buffer.commit(2);
+        REQUIRE(calls == 1);
+        REQUIRE(level == capacity / 2 + 1);
+
+        buffer.reserve(1);
+        buffer.commit(1);
+        REQUIRE(calls == 1);
+
+        // The level is checked on every commit.
+        buffer.peek(capacity);
+        buffer.release(capacity / 2 + 2);
+        buffer.reserve(1);
+        buffer.commit(1);
+        REQUIRE(calls == 1);
+
+        buffer.reserve(capacity / 2);
+        buffer.commit(capacity / 2);
+        REQUIRE(calls == 2);
+    }
+
+    SECTION("Get Across the End") {
+        Memory::SpscCircularBuffer<U64> buffer(8);
+        const U64 capacity = buffer.getCapacity();
+
+        buffer.reserve(capacity - 2);
+        buffer.commit(capacity - 2);
+        buffer.release(capacity - 2);
+
+        for (U64 i = 0; i < 5;) {
+            auto span = buffer.reserve(5 - i);
+            for (auto& value : span) {
+                value = i++;
+            }
+            buffer.commit(span.size());
+        }
+
+        std::vector<U64> data(5);
+        REQUIRE(buffer.get(data.data(), 6) == Result::TIMEOUT);
+        REQUIRE(buffer.get(data.data(), 5) == Result::SUCCESS);
+        REQUIRE(data == std::vector<U64>({0, 1, 2, 3, 4}));
+        REQUIRE(buffer.isEmpty());
+    }
+
+    SECTION("Concurrent Stream") {
+        Memory::SpscCircularBuffer<U64> buffer(1000);
+        buffer.setOverflowPolicy(Memory::OverflowPolicy::DROP_NEWEST);
+
+        const U64 elements = 1000000;
+
+        std::thread producer([&]{
+            for (U64 next = 0; next < elements;) {
+                auto span = buffer.reserve(std::min<U64>(333, elements - next));
+                for (auto& value : span) {
+                    value = next++;
+                }
+                buffer.commit(span.size());
+            }
+        });
+
+        U64 next = 0;
+        bool ordered = true;
+        while (next < elements) {
+            const auto span = buffer.peek(256);
+            for (const auto& value : span) {
+                ordered &= (value == next++);
+            }
+            buffer.release(span.size());
+        }
+
+        producer.join();
+
+        REQUIRE(ordered == true);
+        REQUIRE(buffer.isEmpty());
+    }
+
+    SECTION("Concurrent Stream Drops Oldest") {
+        Memory::SpscCircularBuffer<U64> buffer(1000);
+        buffer.setOverflowPolicy(Memory::OverflowPolicy::DROP_OLDEST, std::chrono::milliseconds(1));
+
+        const U64 elements = 1000000;
+        std::atomic<bool> done{false};
+
+        std::thread producer([&]{
+            for (U64 next = 0; next < elements;) {
+                const U64 size = std::min<U64>(333, elements - next);
+                auto span = buffer.reserve(size);
+                if (span.empty()) {
+                    buffer.overflow(size);
+                    next += size;
+                    continue;
+                }
+                for (auto& value : span) {
+                    value = next++;
+                }
+                buffer.commit(span.size());
+            }
+            done = true;
+        });
+
+        // A slow consumer sees gaps but every element is either read or dropped once.
+        U64 received = 0;
+        U64 last = 0;
+        bool ordered = true;
+        while (!done || !buffer.isEmpty()) {
+            const auto span = buffer.peek(256);
+            for (const auto& value : span) {
+                ordered &= (received == 0 || value > last);
+                last = value;
+                received += 1;
+            }
+            buffer.release(span.size());
+            if (received % 7 == 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(10));
+            }
+        }
+
+        producer.join();
+
+        REQUIRE(ordered == true);
+        REQUIRE(received + buffer.getDroppedElements() == elements);
+    }
+}
+
+TEST_CASE("MirroredMemory Class Tests", "[MirroredMemory]") {
+    SECTION("Both Copies Share Pages") {
+        Memory::MirroredMemory memory;
+        const U64 size = Memory::MirroredMemory::Granularity();
+
+        REQUIRE(memory.allocate(size) == Result::SUCCESS);
+        REQUIRE(memory.size() == size);
+
+        auto* data = static_cast<U8*>(memory.data());
+        data[0] = 42;
+        data[size - 1] = 7;
+
+        if (memory.mirrored()) {
+            REQUIRE(data[size] == 42);
+            REQUIRE(data[2 * size - 1] == 7);
+
+            data[size + 1] = 9;
+            REQUIRE(data[1] == 9);
+        }
+
+        memory.release();
+        REQUIRE(memory.data() == nullptr);
+    }
+
+    SECTION("Every Copy Shares Pages") {
+        Memory::MirroredMemory memory;
+        const U64 size = Memory::MirroredMemory::Granularity();
+
+        REQUIRE(memory.allocate(size, 4) == Result::SUCCESS);
+
+        auto* data = static_cast<U8*>(memory.data());
+        data[3] = 11;
+
+        if (memory.mirrored()) {
+            REQUIRE(memory.copies() == 4);
+            REQUIRE(data[size + 3] == 11);
+            REQUIRE(data[3 * size + 3] == 11);
+
+            data[2 * size + 5] = 13;
+            REQUIRE(data[5] == 13);
+        } else {
+            REQUIRE(memory.copies() == 1);
+        }
+    }
+
+    SECTION("Size Must Fill Pages") {
+        Memory::MirroredMemory memory;
+
+        REQUIRE(memory.allocate(Memory::MirroredMemory::Granularity() + 1) == Result::ERROR);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
@@ -18,6 +18,42 @@ TEST_CASE("Storage Class Tests", "[Storage]") {
         REQUIRE(storage.attributes().empty());
     }
 
+    SECTION("Multi-buffer") {
+        Tensor<Device::CPU, F32> storage({4});
+        storage[0] = 1.0f;
+
+        REQUIRE(storage.multibuffer(3) == Result::SUCCESS);
+
+        TensorBuffer<Device::CPU>::SetActiveSlot(1);
+        REQUIRE(storage[0] == 1.0f);
+        storage[0] = 2.0f;
+
+        TensorBuffer<Device::CPU>::SetActiveSlot(0);
+        REQUIRE(storage[0] == 1.0f);
+
+        REQUIRE(storage.multibuffer(1) == Result::SUCCESS);
+        TensorBuffer<Device::CPU>::SetActiveSlot(1);
+        REQUIRE(storage[0] == 1.0f);
+        TensorBuffer<Device::CPU>::SetActiveSlot(0);
+    }
+
+    SECTION("Alias") {
+        Tensor<Device::CPU, F32> arena({8});
+        Tensor<Device::CPU, F32> storage({4});
+        Tensor<Device::CPU, F32> view(storage);
+
+        REQUIRE(storage.alias(arena.data() + 4) == Result::SUCCESS);
+        REQUIRE(view.data() == arena.data() + 4);
+        REQUIRE(storage.multibuffer(2) == Result::ERROR);
+
+        view[0] = 3.0f;
+        REQUIRE(arena[4] == 3.0f);
+
+        REQUIRE(storage.unalias() == Result::SUCCESS);
+        REQUIRE(view.data() != arena.data() + 4);
+        REQUIRE(storage[0] == 3.0f);
+    }
+
     // TODO: Add more tests.
 
 #if defined(JETSTREAM_BACKEND_VULKAN_AVAILABLE)
@@ -0,0 +1,94 @@
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/memory/base.hh"
+#include "jetstream/memory/devices/cpu/view.hh"
+
+using namespace Jetstream;
+
+// Fills a tensor with its flat index plus one.
+static void Fill(Tensor<Device::CPU, F32>& tensor) {
+    for (U64 i = 0; i < tensor.size(); i++) {
+        tensor[i] = static_cast<F32>(i + 1);
+    }
+}
+
+TEST_CASE("TensorView Tests", "[TensorView]") {
+    SECTION("From Tensor") {
+        Tensor<Device::CPU, F32> a({3, 4, 5});
+        Fill(a);
+
+        Memory::CPU::TensorView<F32, 3> view(a);
+
+        REQUIRE(view.size() == 60);
+        REQUIRE(view.shape(1) == 4);
+        REQUIRE(view.stride(0) == 20);
+        REQUIRE(view[{2, 1, 3}] == a[{2, 1, 3}]);
+    }
+
+    SECTION("Sliced Tensor") {
+        Tensor<Device::CPU, F32> a({4, 6});
+        Fill(a);
+
+        REQUIRE(a.slice({{1, 3}, {0, 6, 2}}) == Result::SUCCESS);
+
+        Memory::CPU::TensorView<F32, 2> view(a);
+
+        REQUIRE(view.shape() == std::array<U64, 2>{2, 3});
+        REQUIRE(view[{0, 0}] == a[{0, 0}]);
+        REQUIRE(view[{1, 2}] == a[{1, 2}]);
+    }
+
+    SECTION("Slice And Broadcast") {
+        Tensor<Device::CPU, F32> a({3, 8});
+        Tensor<Device::CPU, F32> b({3, 2});
+        Fill(a);
+
+        Memory::CPU::TensorView<F32, 2> src(a);
+        Memory::CPU::TensorView<F32, 2> dst(b);
+
+        Memory::CPU::ForEach([](F32& o, const F32& x) {
+            o = x;
+        }, dst, src.slice(1, 5, 2));
+
+        REQUIRE(b[{0, 0}] == 6);
+        REQUIRE(b[{2, 1}] == 23);
+
+        Memory::CPU::ForEach([](F32& o, const F32& x) {
+            o = x;
+        }, dst, src.slice(0, 1, 1).slice(1, 0, 2).broadcast(0, 3));
+
+        REQUIRE(b[{0, 0}] == 9);
+        REQUIRE(b[{2, 1}] == 10);
+    }
+
+    SECTION("Empty") {
+        Tensor<Device::CPU, F32> a({2, 4});
+
+        U64 calls = 0;
+        Memory::CPU::ForEach([&](F32&) {
+            calls += 1;
+        }, Memory::CPU::TensorView<F32, 2>(a).slice(1, 2, 0));
+
+        REQUIRE(calls == 0);
+    }
+
+    SECTION("Rank Dispatch") {
+        U64 rank = 0;
+        REQUIRE(Memory::CPU::DispatchRank(3, [&](auto value) {
+            rank = value;
+            return Result::SUCCESS;
+        }) == Result::SUCCESS);
+        REQUIRE(rank == 3);
+
+        REQUIRE(Memory::CPU::DispatchRank(9, [](auto) {
+            return Result::SUCCESS;
+        }) == Result::ERROR);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}
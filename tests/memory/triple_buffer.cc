@@ -0,0 +1,108 @@
+#include <thread>
+
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "jetstream/logger.hh"
+#include "jetstream/memory/utils/triple_buffer.hh"
+
+using namespace Jetstream;
+
+TEST_CASE("TripleBuffer Class Tests", "[TripleBuffer]") {
+    SECTION("Reset") {
+        Memory::TripleBuffer<std::vector<U64>> buffer;
+        buffer.reset(4, 7);
+
+        REQUIRE(buffer.consume() == false);
+        REQUIRE(buffer.getWriteSlot() == std::vector<U64>(4, 7));
+        REQUIRE(buffer.getReadSlot() == std::vector<U64>(4, 7));
+    }
+
+    SECTION("Publish and Consume") {
+        Memory::TripleBuffer<U64> buffer;
+        buffer.reset();
+
+        buffer.getWriteSlot() = 1;
+        buffer.publish();
+
+        REQUIRE(buffer.consume() == true);
+        REQUIRE(buffer.getReadSlot() == 1);
+        REQUIRE(buffer.consume() == false);
+        REQUIRE(buffer.getReadSlot() == 1);
+    }
+
+    SECTION("Latest Value Wins") {
+        Memory::TripleBuffer<U64> buffer;
+        buffer.reset();
+
+        for (U64 i = 1; i <= 5; i++) {
+            buffer.getWriteSlot() = i;
+            buffer.publish();
+        }
+
+        REQUIRE(buffer.consume() == true);
+        REQUIRE(buffer.getReadSlot() == 5);
+        REQUIRE(buffer.consume() == false);
+    }
+
+    SECTION("Slots Are Not Shared") {
+        Memory::TripleBuffer<U64> buffer;
+        buffer.reset();
+
+        buffer.getWriteSlot() = 1;
+        buffer.publish();
+        REQUIRE(buffer.consume() == true);
+
+        buffer.getWriteSlot() = 2;
+        buffer.publish();
+        buffer.getWriteSlot() = 3;
+
+        REQUIRE(buffer.getReadSlot() == 1);
+        REQUIRE(buffer.consume() == true);
+        REQUIRE(buffer.getReadSlot() == 2);
+    }
+
+    SECTION("Concurrent Handoff") {
+        Memory::TripleBuffer<std::vector<U64>> buffer;
+        buffer.reset(1024, 0);
+
+        const U64 frames = 100000;
+
+        std::thread producer([&]{
+            for (U64 frame = 1; frame <= frames; frame++) {
+                auto& slot = buffer.getWriteSlot();
+                for (auto& value : slot) {
+                    value = frame;
+                }
+                buffer.publish();
+            }
+        });
+
+        U64 last = 0;
+        bool torn = false;
+        bool ordered = true;
+        while (last < frames) {
+            if (!buffer.consume()) {
+                continue;
+            }
+            const auto& slot = buffer.getReadSlot();
+            for (const auto& value : slot) {
+                torn |= (value != slot[0]);
+            }
+            ordered &= (slot[0] > last);
+            last = slot[0];
+        }
+
+        producer.join();
+
+        REQUIRE(torn == false);
+        REQUIRE(ordered == true);
+        REQUIRE(last == frames);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    JST_LOG_SET_DEBUG_LEVEL(4);
+
+    return Catch::Session().run(argc, argv);
+}